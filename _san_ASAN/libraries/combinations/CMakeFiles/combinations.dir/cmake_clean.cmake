@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/combinations.dir/src/Builtin.cpp.o"
+  "CMakeFiles/combinations.dir/src/Builtin.cpp.o.d"
+  "generated/builtin.inc"
+  "libcombinations.a"
+  "libcombinations.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/combinations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
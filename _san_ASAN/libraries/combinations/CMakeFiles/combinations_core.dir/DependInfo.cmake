@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libraries/combinations/src/Adaptive.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Adaptive.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Adaptive.cpp.o.d"
+  "/root/repo/libraries/combinations/src/Analysis.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Analysis.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Analysis.cpp.o.d"
+  "/root/repo/libraries/combinations/src/Book.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Book.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Book.cpp.o.d"
+  "/root/repo/libraries/combinations/src/Cache.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Cache.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Cache.cpp.o.d"
+  "/root/repo/libraries/combinations/src/Catalogue.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Catalogue.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Catalogue.cpp.o.d"
+  "/root/repo/libraries/combinations/src/Combination.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Combination.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Combination.cpp.o.d"
+  "/root/repo/libraries/combinations/src/Combinations.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Combinations.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Combinations.cpp.o.d"
+  "/root/repo/libraries/combinations/src/Component.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Component.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Component.cpp.o.d"
+  "/root/repo/libraries/combinations/src/DateTime.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/DateTime.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/DateTime.cpp.o.d"
+  "/root/repo/libraries/combinations/src/Input.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Input.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Input.cpp.o.d"
+  "/root/repo/libraries/combinations/src/Protocol.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Protocol.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Protocol.cpp.o.d"
+  "/root/repo/libraries/combinations/src/Signature.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Signature.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Signature.cpp.o.d"
+  "/root/repo/libraries/combinations/src/SlowLog.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/SlowLog.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/SlowLog.cpp.o.d"
+  "/root/repo/libraries/combinations/src/Stream.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Stream.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Stream.cpp.o.d"
+  "/root/repo/libraries/combinations/src/Unclassifiable.cpp" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Unclassifiable.cpp.o" "gcc" "libraries/combinations/CMakeFiles/combinations_core.dir/src/Unclassifiable.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_san_ASAN/libraries/combinations/CMakeFiles/pugixml_shim.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/embed.dir/tools/embed.cpp.o"
+  "CMakeFiles/embed.dir/tools/embed.cpp.o.d"
+  "embed"
+  "embed.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/embed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/etc"
+  "etc/combinations.xml"
+  "etc/empty.xml"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/etc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
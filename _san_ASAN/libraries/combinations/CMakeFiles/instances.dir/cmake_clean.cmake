@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/instances.dir/tools/instances.cpp.o"
+  "CMakeFiles/instances.dir/tools/instances.cpp.o.d"
+  "instances"
+  "instances.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/instances.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/load.dir/benchmarks/load.cpp.o"
+  "CMakeFiles/load.dir/benchmarks/load.cpp.o.d"
+  "load"
+  "load.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/load.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
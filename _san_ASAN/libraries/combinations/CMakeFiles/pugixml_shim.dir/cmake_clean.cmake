@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pugixml_shim.dir/tmp/gate/pugi/pugixml.cpp.o"
+  "CMakeFiles/pugixml_shim.dir/tmp/gate/pugi/pugixml.cpp.o.d"
+  "libpugixml_shim.a"
+  "libpugixml_shim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pugixml_shim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libraries/combinations/tests/load_test.cpp" "libraries/combinations/CMakeFiles/tests.dir/tests/load_test.cpp.o" "gcc" "libraries/combinations/CMakeFiles/tests.dir/tests/load_test.cpp.o.d"
+  "/root/repo/libraries/combinations/tests/test.cpp" "libraries/combinations/CMakeFiles/tests.dir/tests/test.cpp.o" "gcc" "libraries/combinations/CMakeFiles/tests.dir/tests/test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_san_ASAN/libraries/combinations/CMakeFiles/combinations.dir/DependInfo.cmake"
+  "/root/repo/_san_ASAN/libraries/combinations/CMakeFiles/combinations_core.dir/DependInfo.cmake"
+  "/root/repo/_san_ASAN/libraries/combinations/CMakeFiles/pugixml_shim.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/traffic.dir/benchmarks/traffic.cpp.o"
+  "CMakeFiles/traffic.dir/benchmarks/traffic.cpp.o.d"
+  "traffic"
+  "traffic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/traffic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libraries/combinations
+# Build directory: /root/repo/_san_ASAN/libraries/combinations
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_san_ASAN/libraries/combinations/tests[1]_include.cmake")
@@ -0,0 +1,807 @@
+add_test([=[LoadTest.many]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=LoadTest.many]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoadTest.many]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ComponentTest.from_string_basic]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=ComponentTest.from_string_basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ComponentTest.from_string_basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsResourceTest.empty_path]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsResourceTest.empty_path]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsResourceTest.empty_path]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsResourceTest.resource_does_not_exist]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsResourceTest.resource_does_not_exist]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsResourceTest.resource_does_not_exist]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsResourceTest.buffer]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsResourceTest.buffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsResourceTest.buffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsResourceTest.fractional_ratio]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsResourceTest.fractional_ratio]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsResourceTest.fractional_ratio]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsResourceTest.tolerance]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsResourceTest.tolerance]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsResourceTest.tolerance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsResourceTest.scaled_ratios]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsResourceTest.scaled_ratios]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsResourceTest.scaled_ratios]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsResourceTest.shadowed_types]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsResourceTest.shadowed_types]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsResourceTest.shadowed_types]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsResourceTest.unclassified_filter]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsResourceTest.unclassified_filter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsResourceTest.unclassified_filter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsResourceTest.persistent_cache]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsResourceTest.persistent_cache]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsResourceTest.persistent_cache]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsResourceTest.cache_type_range]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsResourceTest.cache_type_range]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsResourceTest.cache_type_range]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsResourceTest.cached_order]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsResourceTest.cached_order]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsResourceTest.cached_order]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsResourceTest.many_types]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsResourceTest.many_types]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsResourceTest.many_types]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsResourceTest.empty_resource]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsResourceTest.empty_resource]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsResourceTest.empty_resource]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsResourceTest.slow_log]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsResourceTest.slow_log]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsResourceTest.slow_log]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.empty]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.order_not_empty]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.order_not_empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.order_not_empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.order_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.order_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.order_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.order_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.order_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.order_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.order_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.order_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.order_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.min_count_ok]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.min_count_ok]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.min_count_ok]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.min_count_fail]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.min_count_fail]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.min_count_fail]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.much_more]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.much_more]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.much_more]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.much_more_fail]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.much_more_fail]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.much_more_fail]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.strategy]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.strategy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.strategy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.backtracking_equal_legs]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.backtracking_equal_legs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.backtracking_equal_legs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.budget_exceeded]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.budget_exceeded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.budget_exceeded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.budget_enough]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.budget_enough]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.budget_enough]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.budget_deadline]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.budget_deadline]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.budget_deadline]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.classify_all]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.classify_all]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.classify_all]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.classify_all_unclassified]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.classify_all_unclassified]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.classify_all_unclassified]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.matches_lazy]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.matches_lazy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.matches_lazy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.orderings]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.orderings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.orderings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.orderings_count]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.orderings_count]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.orderings_count]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.chain_order]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.chain_order]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.chain_order]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.chain_equal_levels]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.chain_equal_levels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.chain_equal_levels]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.chain_tie_fail]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.chain_tie_fail]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.chain_tie_fail]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.large_values]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.large_values]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.large_values]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.tiny_ratios]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.tiny_ratios]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.tiny_ratios]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.decompose]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.decompose]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.decompose]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.decompose_repair]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.decompose_repair]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.decompose_repair]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.session]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.session]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.session]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.stream]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.stream]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.stream]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.stream_backlog]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.stream_backlog]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.stream_backlog]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.shared_catalogue]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.shared_catalogue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.shared_catalogue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.catalogue_admits]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.catalogue_admits]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.catalogue_admits]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.exclusive_types]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.exclusive_types]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.exclusive_types]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.adaptive_order]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.adaptive_order]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.adaptive_order]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.instances]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.instances]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.instances]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.fuzz_corpus]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.fuzz_corpus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.fuzz_corpus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.builtin_catalogue]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.builtin_catalogue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.builtin_catalogue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Inter_commodity_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Inter_commodity_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Inter_commodity_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Inter_commodity_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Inter_commodity_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Inter_commodity_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Future_calendar_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Future_calendar_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Future_calendar_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Future_calendar_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Future_calendar_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Future_calendar_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Future_butterfly_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Future_butterfly_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Future_butterfly_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Future_butterfly_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Future_butterfly_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Future_butterfly_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Future_butterfly_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Future_butterfly_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Future_butterfly_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Future_condor_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Future_condor_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Future_condor_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Future_condor_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Future_condor_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Future_condor_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Future_condor_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Future_condor_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Future_condor_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Pack_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Pack_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Pack_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Pack_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Pack_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Pack_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Pack_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Pack_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Pack_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Bundle_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Bundle_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Bundle_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Bundle_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Bundle_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Bundle_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Bundle_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Bundle_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Bundle_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Strip_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Strip_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Strip_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Jelly_roll_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Jelly_roll_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Jelly_roll_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Jelly_roll_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Jelly_roll_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Jelly_roll_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Jelly_roll_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Jelly_roll_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Jelly_roll_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_butterfly_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_butterfly_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_butterfly_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_butterfly_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_butterfly_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_butterfly_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_butterfly_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_butterfly_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_butterfly_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_calendar_butterfly_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_calendar_butterfly_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_calendar_butterfly_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_calendar_butterfly_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_calendar_butterfly_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_calendar_butterfly_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_calendar_butterfly_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_calendar_butterfly_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_calendar_butterfly_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Skinny_call_butterfly_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Skinny_call_butterfly_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Skinny_call_butterfly_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Skinny_call_butterfly_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Skinny_call_butterfly_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Skinny_call_butterfly_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Skinny_call_butterfly_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Skinny_call_butterfly_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Skinny_call_butterfly_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_butterfly_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_butterfly_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_butterfly_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_butterfly_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_butterfly_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_butterfly_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_butterfly_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_butterfly_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_butterfly_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_calendar_butterfly_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_calendar_butterfly_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_calendar_butterfly_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_calendar_butterfly_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_calendar_butterfly_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_calendar_butterfly_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_calendar_butterfly_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_calendar_butterfly_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_calendar_butterfly_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Skinny_put_butterfly_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Skinny_put_butterfly_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Skinny_put_butterfly_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Skinny_put_butterfly_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Skinny_put_butterfly_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Skinny_put_butterfly_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Skinny_put_butterfly_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Skinny_put_butterfly_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Skinny_put_butterfly_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_calendar_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_calendar_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_calendar_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_calendar_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_calendar_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_calendar_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_calendar_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_calendar_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_calendar_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_calendar_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_calendar_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_calendar_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_diagonal_calendar_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_diagonal_calendar_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_diagonal_calendar_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_diagonal_calendar_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_diagonal_calendar_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_diagonal_calendar_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_diagonal_calendar_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_diagonal_calendar_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_diagonal_calendar_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_diagonal_calendar_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_diagonal_calendar_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_diagonal_calendar_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Guts_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Guts_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Guts_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Guts_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Guts_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Guts_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_call_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_call_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_call_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_call_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_call_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_call_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x1_ratio_call_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x1_ratio_call_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x1_ratio_call_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x1_ratio_call_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x1_ratio_call_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x1_ratio_call_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.1x2_ratio_call_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.1x2_ratio_call_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.1x2_ratio_call_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.1x2_ratio_call_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.1x2_ratio_call_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.1x2_ratio_call_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.1x3_ratio_call_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.1x3_ratio_call_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.1x3_ratio_call_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.1x3_ratio_call_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.1x3_ratio_call_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.1x3_ratio_call_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3_ratio_call_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3_ratio_call_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3_ratio_call_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3_ratio_call_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3_ratio_call_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3_ratio_call_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_put_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_put_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_put_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_put_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_put_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_put_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x1_ratio_put_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x1_ratio_put_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x1_ratio_put_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x1_ratio_put_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x1_ratio_put_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x1_ratio_put_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.1x2_ratio_put_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.1x2_ratio_put_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.1x2_ratio_put_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.1x2_ratio_put_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.1x2_ratio_put_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.1x2_ratio_put_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.1x3_ratio_put_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.1x3_ratio_put_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.1x3_ratio_put_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.1x3_ratio_put_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.1x3_ratio_put_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.1x3_ratio_put_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3_ratio_put_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3_ratio_put_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3_ratio_put_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3_ratio_put_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3_ratio_put_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3_ratio_put_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_butterfly_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_butterfly_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_butterfly_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_butterfly_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_butterfly_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_butterfly_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_butterfly_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_butterfly_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_butterfly_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Combo_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Combo_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Combo_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Combo_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Combo_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Combo_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Strangle_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Strangle_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Strangle_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Strangle_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Strangle_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Strangle_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_ladder_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_ladder_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_ladder_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_ladder_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_ladder_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_ladder_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_ladder_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_ladder_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_ladder_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_ladder_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_ladder_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_ladder_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_ladder_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_ladder_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_ladder_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_ladder_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_ladder_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_ladder_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_calendar_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_calendar_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_calendar_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_calendar_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_calendar_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_calendar_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_calendar_spread_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_calendar_spread_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_calendar_spread_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Diagonal_straddle_calendar_spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Diagonal_straddle_calendar_spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Diagonal_straddle_calendar_spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Diagonal_straddle_calendar_spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Diagonal_straddle_calendar_spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Diagonal_straddle_calendar_spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Diagonal_straddle_calendar_spread_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Diagonal_straddle_calendar_spread_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Diagonal_straddle_calendar_spread_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_condor_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_condor_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_condor_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_condor_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_condor_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_condor_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_condor_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_condor_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_condor_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_condor_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_condor_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_condor_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_condor_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_condor_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_condor_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_condor_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_condor_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_condor_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Box_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Box_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Box_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Box_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Box_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Box_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Box_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Box_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Box_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Synthetic_conversion_reversal_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Synthetic_conversion_reversal_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Synthetic_conversion_reversal_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Synthetic_conversion_reversal_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Synthetic_conversion_reversal_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Synthetic_conversion_reversal_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Fence_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Fence_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Fence_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Fence_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Fence_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Fence_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_condor_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_condor_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_condor_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_condor_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_condor_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_condor_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_condor_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_condor_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_condor_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_spread_vs_put_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_spread_vs_put_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_spread_vs_put_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_spread_vs_put_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_spread_vs_put_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_spread_vs_put_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_spread_vs_put_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_spread_vs_put_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_spread_vs_put_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_spread_vs_call_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_spread_vs_call_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_spread_vs_call_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_spread_vs_call_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_spread_vs_call_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_spread_vs_call_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_spread_vs_call_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_spread_vs_call_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_spread_vs_call_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_vs_call_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_vs_call_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_vs_call_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_vs_call_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_vs_call_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_vs_call_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_vs_call_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_vs_call_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_vs_call_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_vs_put_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_vs_put_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_vs_put_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_vs_put_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_vs_put_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_vs_put_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_vs_put_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_vs_put_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_vs_put_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_double_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_double_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_double_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_double_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_double_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_double_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_double_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_double_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_double_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_double_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_double_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_double_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_strip_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_strip_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_strip_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_strip_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_strip_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_strip_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_strip_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_strip_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_strip_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_strip_jumps_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_strip_jumps_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_strip_jumps_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_strip_jumps_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_strip_jumps_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_strip_jumps_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_strip_jumps_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_strip_jumps_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_strip_jumps_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_strip_jumps_leap_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_strip_jumps_leap_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_strip_jumps_leap_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_strip_jumps_leap_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_strip_jumps_leap_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_strip_jumps_leap_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_strip_jumps_leap_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_strip_jumps_leap_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_strip_jumps_leap_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_strip_jumps_leap_fail]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_strip_jumps_leap_fail]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_strip_jumps_leap_fail]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Options_strip_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Options_strip_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Options_strip_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Call_Butterfly_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Call_Butterfly_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Call_Butterfly_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Put_Butterfly_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Put_Butterfly_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Put_Butterfly_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Put_Spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Put_Spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Put_Spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Put_Spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Put_Spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Put_Spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Call_Spread_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Call_Spread_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Call_Spread_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Call_Spread_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Call_Spread_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Call_Spread_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_Fly_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_Fly_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_Fly_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_Fly_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_Fly_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_Fly_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_Fly_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_Fly_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_Fly_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Risky_Swap_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Risky_Swap_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Risky_Swap_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Risky_Swap_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Risky_Swap_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Risky_Swap_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Risky_Swap_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Risky_Swap_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Risky_Swap_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_Spread_Swap_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_Spread_Swap_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_Spread_Swap_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_Spread_Swap_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_Spread_Swap_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_Spread_Swap_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_Spread_Swap_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_Spread_Swap_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_Spread_Swap_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_Spread_Swap_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_Spread_Swap_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_Spread_Swap_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_Spread_Swap_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_Spread_Swap_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_Spread_Swap_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_Spread_Swap_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_Spread_Swap_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_Spread_Swap_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_swap_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_swap_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_swap_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_swap_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_swap_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_swap_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_swap_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_swap_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_swap_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_volatility_trade_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_volatility_trade_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_volatility_trade_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_volatility_trade_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_volatility_trade_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_volatility_trade_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_volatility_trade_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_volatility_trade_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_volatility_trade_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_volatility_trade_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_volatility_trade_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_volatility_trade_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_spread_vs_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_spread_vs_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_spread_vs_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_spread_vs_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_spread_vs_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_spread_vs_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_spread_vs_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_spread_vs_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_spread_vs_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_spread_vs_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_spread_vs_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_spread_vs_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_spread_vs_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_spread_vs_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_spread_vs_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_spread_vs_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_spread_vs_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_spread_vs_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Strangle_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Strangle_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Strangle_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Strangle_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Strangle_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Strangle_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Strangle_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Strangle_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Strangle_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Strangle_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Strangle_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Strangle_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Strangle_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Strangle_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Strangle_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Strangle_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Strangle_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Strangle_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_spread_vs_sell_put_vs_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_spread_vs_sell_put_vs_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_spread_vs_sell_put_vs_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_spread_vs_sell_put_vs_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_spread_vs_sell_put_vs_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_spread_vs_sell_put_vs_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_spread_vs_sell_put_vs_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_spread_vs_sell_put_vs_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_spread_vs_sell_put_vs_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_spread_vs_sell_call_vs_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_spread_vs_sell_call_vs_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_spread_vs_sell_call_vs_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_spread_vs_sell_call_vs_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_spread_vs_sell_call_vs_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_spread_vs_sell_call_vs_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_spread_vs_sell_call_vs_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_spread_vs_sell_call_vs_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_spread_vs_sell_call_vs_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_ladder_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_ladder_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_ladder_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_ladder_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_ladder_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_ladder_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_ladder_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_ladder_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_ladder_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_ladder_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_ladder_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_ladder_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_ladder_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_ladder_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_ladder_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_ladder_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_ladder_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_ladder_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_ladder_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_ladder_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_ladder_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_ladder_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_ladder_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_ladder_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_ladder_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_ladder_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_ladder_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_ladder_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_ladder_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_ladder_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_ladder_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_ladder_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_ladder_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_ladder_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_ladder_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_ladder_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Combo_vs_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Combo_vs_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Combo_vs_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Combo_vs_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Combo_vs_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Combo_vs_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Combo_vs_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Combo_vs_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Combo_vs_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_calendar_spread_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_calendar_spread_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_calendar_spread_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_calendar_spread_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_calendar_spread_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_calendar_spread_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_calendar_spread_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_calendar_spread_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_calendar_spread_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_calendar_spread_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_calendar_spread_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_calendar_spread_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_calendar_spread_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_calendar_spread_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_calendar_spread_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_calendar_spread_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_calendar_spread_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_calendar_spread_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_calendar_spread_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_calendar_spread_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_calendar_spread_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_calendar_spread_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_calendar_spread_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_calendar_spread_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_calendar_spread_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_calendar_spread_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_calendar_spread_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_calendar_spread_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_calendar_spread_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_calendar_spread_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_calendar_spread_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_calendar_spread_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_calendar_spread_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_calendar_spread_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_calendar_spread_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_calendar_spread_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_call_spread_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_call_spread_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_call_spread_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_call_spread_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_call_spread_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_call_spread_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_call_spread_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_call_spread_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_call_spread_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_call_spread_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_call_spread_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_call_spread_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_call_spread_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_call_spread_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_call_spread_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_call_spread_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_call_spread_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_call_spread_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_put_spread_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_put_spread_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_put_spread_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_put_spread_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_put_spread_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_put_spread_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_put_spread_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_put_spread_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_put_spread_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_put_spread_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_put_spread_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_put_spread_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_put_spread_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_put_spread_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_put_spread_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x1_ratio_put_spread_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x1_ratio_put_spread_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x1_ratio_put_spread_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Conversion_reversal_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Conversion_reversal_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Conversion_reversal_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Conversion_reversal_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Conversion_reversal_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Conversion_reversal_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Conversion_reversal_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Conversion_reversal_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Conversion_reversal_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_calendar_spread_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_calendar_spread_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_calendar_spread_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_calendar_spread_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_calendar_spread_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_calendar_spread_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_calendar_spread_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_calendar_spread_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_calendar_spread_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_calendar_spread_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_calendar_spread_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_calendar_spread_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_calendar_spread_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_calendar_spread_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_calendar_spread_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_calendar_spread_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_calendar_spread_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_calendar_spread_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_diagonal_calendar_spread_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_diagonal_calendar_spread_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_diagonal_calendar_spread_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_diagonal_calendar_spread_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_diagonal_calendar_spread_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_diagonal_calendar_spread_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_diagonal_calendar_spread_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_diagonal_calendar_spread_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_diagonal_calendar_spread_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_diagonal_calendar_spread_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_diagonal_calendar_spread_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_diagonal_calendar_spread_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_diagonal_calendar_spread_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_diagonal_calendar_spread_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_diagonal_calendar_spread_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_diagonal_calendar_spread_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_diagonal_calendar_spread_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_diagonal_calendar_spread_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_diagonal_calendar_spread_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_diagonal_calendar_spread_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_diagonal_calendar_spread_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_diagonal_calendar_spread_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_diagonal_calendar_spread_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_diagonal_calendar_spread_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_diagonal_calendar_spread_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_diagonal_calendar_spread_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_diagonal_calendar_spread_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_diagonal_calendar_spread_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_diagonal_calendar_spread_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_diagonal_calendar_spread_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_diagonal_calendar_spread_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_diagonal_calendar_spread_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_diagonal_calendar_spread_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_diagonal_calendar_spread_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_diagonal_calendar_spread_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_diagonal_calendar_spread_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Guts_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Guts_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Guts_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Guts_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Guts_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Guts_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Guts_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Guts_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Guts_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Guts_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Guts_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Guts_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Guts_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Guts_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Guts_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Guts_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Guts_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Guts_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_butterfly_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_butterfly_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_butterfly_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_butterfly_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_butterfly_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_butterfly_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_butterfly_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_butterfly_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_butterfly_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_butterfly_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_butterfly_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_butterfly_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_butterfly_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_butterfly_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_butterfly_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_butterfly_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_butterfly_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_butterfly_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_butterfly_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_butterfly_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_butterfly_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_butterfly_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_butterfly_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_butterfly_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_butterfly_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_butterfly_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_butterfly_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_butterfly_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_butterfly_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_butterfly_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_butterfly_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_butterfly_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_butterfly_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_butterfly_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_butterfly_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_butterfly_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_butterfly_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_butterfly_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_butterfly_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_butterfly_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_butterfly_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_butterfly_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_butterfly_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_butterfly_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_butterfly_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_butterfly_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_butterfly_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_butterfly_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_butterfly_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_butterfly_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_butterfly_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_butterfly_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_butterfly_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_butterfly_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Diagonal_straddle_calendar_spread_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Diagonal_straddle_calendar_spread_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Diagonal_straddle_calendar_spread_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Diagonal_straddle_calendar_spread_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Diagonal_straddle_calendar_spread_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Diagonal_straddle_calendar_spread_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Diagonal_straddle_calendar_spread_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Diagonal_straddle_calendar_spread_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Diagonal_straddle_calendar_spread_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Diagonal_straddle_calendar_spread_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Diagonal_straddle_calendar_spread_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Diagonal_straddle_calendar_spread_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Diagonal_straddle_calendar_spread_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Diagonal_straddle_calendar_spread_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Diagonal_straddle_calendar_spread_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Diagonal_straddle_calendar_spread_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Diagonal_straddle_calendar_spread_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Diagonal_straddle_calendar_spread_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_condor_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_condor_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_condor_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_condor_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_condor_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_condor_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_condor_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_condor_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_condor_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_condor_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_condor_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_condor_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_condor_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_condor_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_condor_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_condor_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_condor_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_condor_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_condor_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_condor_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_condor_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_condor_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_condor_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_condor_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_condor_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_condor_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_condor_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_condor_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_condor_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_condor_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_condor_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_condor_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_condor_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_condor_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_condor_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_condor_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_condor_vs_buy_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_condor_vs_buy_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_condor_vs_buy_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_condor_vs_buy_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_condor_vs_buy_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_condor_vs_buy_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_condor_vs_buy_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_condor_vs_buy_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_condor_vs_buy_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_condor_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_condor_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_condor_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_condor_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_condor_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_condor_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Iron_condor_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Iron_condor_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Iron_condor_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Fence_vs_sell_underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Fence_vs_sell_underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Fence_vs_sell_underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Fence_vs_sell_underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Fence_vs_sell_underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Fence_vs_sell_underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Fence_vs_sell_underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Fence_vs_sell_underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Fence_vs_sell_underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_Fly_versus_Long_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_Fly_versus_Long_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_Fly_versus_Long_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_Fly_versus_Long_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_Fly_versus_Long_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_Fly_versus_Long_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_Fly_versus_Long_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_Fly_versus_Long_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_Fly_versus_Long_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_Fly_versus_Short_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_Fly_versus_Short_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_Fly_versus_Short_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_Fly_versus_Short_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_Fly_versus_Short_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_Fly_versus_Short_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Straddle_Fly_versus_Short_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Straddle_Fly_versus_Short_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Straddle_Fly_versus_Short_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_long_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_long_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_long_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_long_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_long_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_long_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_long_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_long_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_long_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_short_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_short_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_short_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_short_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_short_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_short_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_short_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_short_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_short_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Long_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Long_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Long_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Long_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Long_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Long_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Long_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Long_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Long_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Short_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Short_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Short_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Short_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Short_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Short_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Short_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Short_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Short_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Put_Spread_Long_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Put_Spread_Long_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Put_Spread_Long_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Put_Spread_Long_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Put_Spread_Long_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Put_Spread_Long_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Put_Spread_Long_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Put_Spread_Long_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Put_Spread_Long_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Put_Spread_Short_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Put_Spread_Short_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Put_Spread_Short_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Put_Spread_Short_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Put_Spread_Short_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Put_Spread_Short_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Put_Spread_Short_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Put_Spread_Short_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Put_Spread_Short_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Call_Spread_Long_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Call_Spread_Long_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Call_Spread_Long_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Call_Spread_Long_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Call_Spread_Long_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Call_Spread_Long_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Call_Spread_Long_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Call_Spread_Long_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Call_Spread_Long_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Call_Spread_Short_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Call_Spread_Short_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Call_Spread_Short_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Call_Spread_Short_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Call_Spread_Short_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Call_Spread_Short_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.3x2_Ratio_Call_Spread_Short_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.3x2_Ratio_Call_Spread_Short_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.3x2_Ratio_Call_Spread_Short_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_Spread_Swap_versus_Long_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_Spread_Swap_versus_Long_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_Spread_Swap_versus_Long_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_Spread_Swap_versus_Long_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_Spread_Swap_versus_Long_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_Spread_Swap_versus_Long_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_Spread_Swap_versus_Long_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_Spread_Swap_versus_Long_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_Spread_Swap_versus_Long_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_Spread_Swap_versus_Short_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_Spread_Swap_versus_Short_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_Spread_Swap_versus_Short_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_Spread_Swap_versus_Short_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_Spread_Swap_versus_Short_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_Spread_Swap_versus_Short_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Call_Spread_Swap_versus_Short_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Call_Spread_Swap_versus_Short_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Call_Spread_Swap_versus_Short_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_Spread_Swap_versus_Long_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_Spread_Swap_versus_Long_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_Spread_Swap_versus_Long_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_Spread_Swap_versus_Long_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_Spread_Swap_versus_Long_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_Spread_Swap_versus_Long_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_Spread_Swap_versus_Long_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_Spread_Swap_versus_Long_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_Spread_Swap_versus_Long_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_Spread_Swap_versus_Short_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_Spread_Swap_versus_Short_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_Spread_Swap_versus_Short_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_Spread_Swap_versus_Short_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_Spread_Swap_versus_Short_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_Spread_Swap_versus_Short_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Put_Spread_Swap_versus_Short_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Put_Spread_Swap_versus_Short_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Put_Spread_Swap_versus_Short_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Risky_Swap_versus_Long_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Risky_Swap_versus_Long_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Risky_Swap_versus_Long_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Risky_Swap_versus_Long_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Risky_Swap_versus_Long_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Risky_Swap_versus_Long_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Risky_Swap_versus_Long_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Risky_Swap_versus_Long_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Risky_Swap_versus_Long_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Risky_Swap_versus_Short_Underlying_direct]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Risky_Swap_versus_Short_Underlying_direct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Risky_Swap_versus_Short_Underlying_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Risky_Swap_versus_Short_Underlying_reverse]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Risky_Swap_versus_Short_Underlying_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Risky_Swap_versus_Short_Underlying_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationsTest.Risky_Swap_versus_Short_Underlying_shuffle]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=CombinationsTest.Risky_Swap_versus_Short_Underlying_shuffle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationsTest.Risky_Swap_versus_Short_Underlying_shuffle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProtocolTest.round_trip]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=ProtocolTest.round_trip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProtocolTest.round_trip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProtocolTest.counts]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=ProtocolTest.counts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProtocolTest.counts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProtocolTest.capture]=]  /root/repo/_san_ASAN/libraries/combinations/tests [==[--gtest_filter=ProtocolTest.capture]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProtocolTest.capture]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_ASAN/libraries/combinations SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  tests_TESTS LoadTest.many ComponentTest.from_string_basic CombinationsResourceTest.empty_path CombinationsResourceTest.resource_does_not_exist CombinationsResourceTest.buffer CombinationsResourceTest.fractional_ratio CombinationsResourceTest.tolerance CombinationsResourceTest.scaled_ratios CombinationsResourceTest.shadowed_types CombinationsResourceTest.unclassified_filter CombinationsResourceTest.persistent_cache CombinationsResourceTest.cache_type_range CombinationsResourceTest.cached_order CombinationsResourceTest.many_types CombinationsResourceTest.empty_resource CombinationsResourceTest.slow_log CombinationsTest.empty CombinationsTest.order_not_empty CombinationsTest.order_direct CombinationsTest.order_reverse CombinationsTest.order_shuffle CombinationsTest.min_count_ok CombinationsTest.min_count_fail CombinationsTest.much_more CombinationsTest.much_more_fail CombinationsTest.strategy CombinationsTest.backtracking_equal_legs CombinationsTest.budget_exceeded CombinationsTest.budget_enough CombinationsTest.budget_deadline CombinationsTest.classify_all CombinationsTest.classify_all_unclassified CombinationsTest.matches_lazy CombinationsTest.orderings CombinationsTest.orderings_count CombinationsTest.chain_order CombinationsTest.chain_equal_levels CombinationsTest.chain_tie_fail CombinationsTest.large_values CombinationsTest.tiny_ratios CombinationsTest.decompose CombinationsTest.decompose_repair CombinationsTest.session CombinationsTest.stream CombinationsTest.stream_backlog CombinationsTest.shared_catalogue CombinationsTest.catalogue_admits CombinationsTest.exclusive_types CombinationsTest.adaptive_order CombinationsTest.instances CombinationsTest.fuzz_corpus CombinationsTest.builtin_catalogue CombinationsTest.Inter_commodity_spread_direct CombinationsTest.Inter_commodity_spread_reverse CombinationsTest.Future_calendar_spread_direct CombinationsTest.Future_calendar_spread_reverse CombinationsTest.Future_butterfly_direct CombinationsTest.Future_butterfly_reverse CombinationsTest.Future_butterfly_shuffle CombinationsTest.Future_condor_direct CombinationsTest.Future_condor_reverse CombinationsTest.Future_condor_shuffle CombinationsTest.Pack_direct CombinationsTest.Pack_reverse CombinationsTest.Pack_shuffle CombinationsTest.Bundle_direct CombinationsTest.Bundle_reverse CombinationsTest.Bundle_shuffle CombinationsTest.Strip_direct CombinationsTest.Jelly_roll_direct CombinationsTest.Jelly_roll_reverse CombinationsTest.Jelly_roll_shuffle CombinationsTest.Call_butterfly_direct CombinationsTest.Call_butterfly_reverse CombinationsTest.Call_butterfly_shuffle CombinationsTest.Call_calendar_butterfly_direct CombinationsTest.Call_calendar_butterfly_reverse CombinationsTest.Call_calendar_butterfly_shuffle CombinationsTest.Skinny_call_butterfly_direct CombinationsTest.Skinny_call_butterfly_reverse CombinationsTest.Skinny_call_butterfly_shuffle CombinationsTest.Put_butterfly_direct CombinationsTest.Put_butterfly_reverse CombinationsTest.Put_butterfly_shuffle CombinationsTest.Put_calendar_butterfly_direct CombinationsTest.Put_calendar_butterfly_reverse CombinationsTest.Put_calendar_butterfly_shuffle CombinationsTest.Skinny_put_butterfly_direct CombinationsTest.Skinny_put_butterfly_reverse CombinationsTest.Skinny_put_butterfly_shuffle CombinationsTest.Call_spread_direct CombinationsTest.Call_spread_reverse CombinationsTest.Put_spread_direct CombinationsTest.Put_spread_reverse CombinationsTest.Call_calendar_spread_direct CombinationsTest.Call_calendar_spread_reverse CombinationsTest.Put_calendar_spread_direct CombinationsTest.Put_calendar_spread_reverse CombinationsTest.Call_diagonal_calendar_spread_direct CombinationsTest.Call_diagonal_calendar_spread_reverse CombinationsTest.Put_diagonal_calendar_spread_direct CombinationsTest.Put_diagonal_calendar_spread_reverse CombinationsTest.Guts_direct CombinationsTest.Guts_reverse CombinationsTest.2x1_ratio_call_spread_direct CombinationsTest.2x1_ratio_call_spread_reverse CombinationsTest.3x1_ratio_call_spread_direct CombinationsTest.3x1_ratio_call_spread_reverse CombinationsTest.1x2_ratio_call_spread_direct CombinationsTest.1x2_ratio_call_spread_reverse CombinationsTest.1x3_ratio_call_spread_direct CombinationsTest.1x3_ratio_call_spread_reverse CombinationsTest.2x3_ratio_call_spread_direct CombinationsTest.2x3_ratio_call_spread_reverse CombinationsTest.2x1_ratio_put_spread_direct CombinationsTest.2x1_ratio_put_spread_reverse CombinationsTest.3x1_ratio_put_spread_direct CombinationsTest.3x1_ratio_put_spread_reverse CombinationsTest.1x2_ratio_put_spread_direct CombinationsTest.1x2_ratio_put_spread_reverse CombinationsTest.1x3_ratio_put_spread_direct CombinationsTest.1x3_ratio_put_spread_reverse CombinationsTest.2x3_ratio_put_spread_direct CombinationsTest.2x3_ratio_put_spread_reverse CombinationsTest.Iron_butterfly_direct CombinationsTest.Iron_butterfly_reverse CombinationsTest.Iron_butterfly_shuffle CombinationsTest.Combo_direct CombinationsTest.Combo_reverse CombinationsTest.Strangle_direct CombinationsTest.Strangle_reverse CombinationsTest.Call_ladder_direct CombinationsTest.Call_ladder_reverse CombinationsTest.Call_ladder_shuffle CombinationsTest.Put_ladder_direct CombinationsTest.Put_ladder_reverse CombinationsTest.Put_ladder_shuffle CombinationsTest.Straddle_calendar_spread_direct CombinationsTest.Straddle_calendar_spread_reverse CombinationsTest.Straddle_calendar_spread_shuffle CombinationsTest.Diagonal_straddle_calendar_spread_direct CombinationsTest.Diagonal_straddle_calendar_spread_reverse CombinationsTest.Diagonal_straddle_calendar_spread_shuffle CombinationsTest.Straddle_direct CombinationsTest.Straddle_reverse CombinationsTest.Call_condor_direct CombinationsTest.Call_condor_reverse CombinationsTest.Call_condor_shuffle CombinationsTest.Put_condor_direct CombinationsTest.Put_condor_reverse CombinationsTest.Put_condor_shuffle CombinationsTest.Box_direct CombinationsTest.Box_reverse CombinationsTest.Box_shuffle CombinationsTest.Synthetic_conversion_reversal_direct CombinationsTest.Synthetic_conversion_reversal_reverse CombinationsTest.Fence_direct CombinationsTest.Fence_reverse CombinationsTest.Iron_condor_direct CombinationsTest.Iron_condor_reverse CombinationsTest.Iron_condor_shuffle CombinationsTest.Call_spread_vs_put_direct CombinationsTest.Call_spread_vs_put_reverse CombinationsTest.Call_spread_vs_put_shuffle CombinationsTest.Put_spread_vs_call_direct CombinationsTest.Put_spread_vs_call_reverse CombinationsTest.Put_spread_vs_call_shuffle CombinationsTest.Straddle_vs_call_direct CombinationsTest.Straddle_vs_call_reverse CombinationsTest.Straddle_vs_call_shuffle CombinationsTest.Straddle_vs_put_direct CombinationsTest.Straddle_vs_put_reverse CombinationsTest.Straddle_vs_put_shuffle CombinationsTest.Call_double_direct CombinationsTest.Call_double_reverse CombinationsTest.Put_double_direct CombinationsTest.Put_double_reverse CombinationsTest.Straddle_strip_direct CombinationsTest.Straddle_strip_reverse CombinationsTest.Straddle_strip_shuffle CombinationsTest.Straddle_strip_jumps_direct CombinationsTest.Straddle_strip_jumps_reverse CombinationsTest.Straddle_strip_jumps_shuffle CombinationsTest.Straddle_strip_jumps_leap_direct CombinationsTest.Straddle_strip_jumps_leap_reverse CombinationsTest.Straddle_strip_jumps_leap_shuffle CombinationsTest.Straddle_strip_jumps_leap_fail CombinationsTest.Options_strip_direct CombinationsTest.2x3x2_Ratio_Call_Butterfly_direct CombinationsTest.2x3x2_Ratio_Call_Butterfly_reverse CombinationsTest.2x3x2_Ratio_Call_Butterfly_shuffle CombinationsTest.2x3x2_Ratio_Put_Butterfly_direct CombinationsTest.2x3x2_Ratio_Put_Butterfly_reverse CombinationsTest.2x3x2_Ratio_Put_Butterfly_shuffle CombinationsTest.3x2_Ratio_Put_Spread_direct CombinationsTest.3x2_Ratio_Put_Spread_reverse CombinationsTest.3x2_Ratio_Call_Spread_direct CombinationsTest.3x2_Ratio_Call_Spread_reverse CombinationsTest.Straddle_Fly_direct CombinationsTest.Straddle_Fly_reverse CombinationsTest.Straddle_Fly_shuffle CombinationsTest.Risky_Swap_direct CombinationsTest.Risky_Swap_reverse CombinationsTest.Risky_Swap_shuffle CombinationsTest.Call_Spread_Swap_direct CombinationsTest.Call_Spread_Swap_reverse CombinationsTest.Call_Spread_Swap_shuffle CombinationsTest.Put_Spread_Swap_direct CombinationsTest.Put_Spread_Swap_reverse CombinationsTest.Put_Spread_Swap_shuffle CombinationsTest.Straddle_swap_direct CombinationsTest.Straddle_swap_reverse CombinationsTest.Straddle_swap_shuffle CombinationsTest.Call_volatility_trade_direct CombinationsTest.Call_volatility_trade_reverse CombinationsTest.Put_volatility_trade_direct CombinationsTest.Put_volatility_trade_reverse CombinationsTest.Call_spread_vs_underlying_direct CombinationsTest.Call_spread_vs_underlying_reverse CombinationsTest.Call_spread_vs_underlying_shuffle CombinationsTest.Put_spread_vs_underlying_direct CombinationsTest.Put_spread_vs_underlying_reverse CombinationsTest.Put_spread_vs_underlying_shuffle CombinationsTest.Straddle_vs_buy_underlying_direct CombinationsTest.Straddle_vs_buy_underlying_reverse CombinationsTest.Straddle_vs_buy_underlying_shuffle CombinationsTest.Straddle_vs_sell_underlying_direct CombinationsTest.Straddle_vs_sell_underlying_reverse CombinationsTest.Straddle_vs_sell_underlying_shuffle CombinationsTest.Strangle_vs_buy_underlying_direct CombinationsTest.Strangle_vs_buy_underlying_reverse CombinationsTest.Strangle_vs_buy_underlying_shuffle CombinationsTest.Strangle_vs_sell_underlying_direct CombinationsTest.Strangle_vs_sell_underlying_reverse CombinationsTest.Strangle_vs_sell_underlying_shuffle CombinationsTest.Call_spread_vs_sell_put_vs_underlying_direct CombinationsTest.Call_spread_vs_sell_put_vs_underlying_reverse CombinationsTest.Call_spread_vs_sell_put_vs_underlying_shuffle CombinationsTest.Put_spread_vs_sell_call_vs_underlying_direct CombinationsTest.Put_spread_vs_sell_call_vs_underlying_reverse CombinationsTest.Put_spread_vs_sell_call_vs_underlying_shuffle CombinationsTest.Call_ladder_vs_buy_underlying_direct CombinationsTest.Call_ladder_vs_buy_underlying_reverse CombinationsTest.Call_ladder_vs_buy_underlying_shuffle CombinationsTest.Call_ladder_vs_sell_underlying_direct CombinationsTest.Call_ladder_vs_sell_underlying_reverse CombinationsTest.Call_ladder_vs_sell_underlying_shuffle CombinationsTest.Put_ladder_vs_buy_underlying_direct CombinationsTest.Put_ladder_vs_buy_underlying_reverse CombinationsTest.Put_ladder_vs_buy_underlying_shuffle CombinationsTest.Put_ladder_vs_sell_underlying_direct CombinationsTest.Put_ladder_vs_sell_underlying_reverse CombinationsTest.Put_ladder_vs_sell_underlying_shuffle CombinationsTest.Combo_vs_underlying_direct CombinationsTest.Combo_vs_underlying_reverse CombinationsTest.Combo_vs_underlying_shuffle CombinationsTest.Call_calendar_spread_vs_buy_underlying_direct CombinationsTest.Call_calendar_spread_vs_buy_underlying_reverse CombinationsTest.Call_calendar_spread_vs_buy_underlying_shuffle CombinationsTest.Call_calendar_spread_vs_sell_underlying_direct CombinationsTest.Call_calendar_spread_vs_sell_underlying_reverse CombinationsTest.Call_calendar_spread_vs_sell_underlying_shuffle CombinationsTest.Put_calendar_spread_vs_buy_underlying_direct CombinationsTest.Put_calendar_spread_vs_buy_underlying_reverse CombinationsTest.Put_calendar_spread_vs_buy_underlying_shuffle CombinationsTest.Put_calendar_spread_vs_sell_underlying_direct CombinationsTest.Put_calendar_spread_vs_sell_underlying_reverse CombinationsTest.Put_calendar_spread_vs_sell_underlying_shuffle CombinationsTest.2x1_ratio_call_spread_vs_buy_underlying_direct CombinationsTest.2x1_ratio_call_spread_vs_buy_underlying_reverse CombinationsTest.2x1_ratio_call_spread_vs_buy_underlying_shuffle CombinationsTest.2x1_ratio_call_spread_vs_sell_underlying_direct CombinationsTest.2x1_ratio_call_spread_vs_sell_underlying_reverse CombinationsTest.2x1_ratio_call_spread_vs_sell_underlying_shuffle CombinationsTest.2x1_ratio_put_spread_vs_buy_underlying_direct CombinationsTest.2x1_ratio_put_spread_vs_buy_underlying_reverse CombinationsTest.2x1_ratio_put_spread_vs_buy_underlying_shuffle CombinationsTest.2x1_ratio_put_spread_vs_sell_underlying_direct CombinationsTest.2x1_ratio_put_spread_vs_sell_underlying_reverse CombinationsTest.2x1_ratio_put_spread_vs_sell_underlying_shuffle CombinationsTest.Conversion_reversal_direct CombinationsTest.Conversion_reversal_reverse CombinationsTest.Conversion_reversal_shuffle CombinationsTest.Straddle_calendar_spread_vs_buy_underlying_direct CombinationsTest.Straddle_calendar_spread_vs_buy_underlying_reverse CombinationsTest.Straddle_calendar_spread_vs_buy_underlying_shuffle CombinationsTest.Straddle_calendar_spread_vs_sell_underlying_direct CombinationsTest.Straddle_calendar_spread_vs_sell_underlying_reverse CombinationsTest.Straddle_calendar_spread_vs_sell_underlying_shuffle CombinationsTest.Call_diagonal_calendar_spread_vs_buy_underlying_direct CombinationsTest.Call_diagonal_calendar_spread_vs_buy_underlying_reverse CombinationsTest.Call_diagonal_calendar_spread_vs_buy_underlying_shuffle CombinationsTest.Call_diagonal_calendar_spread_vs_sell_underlying_direct CombinationsTest.Call_diagonal_calendar_spread_vs_sell_underlying_reverse CombinationsTest.Call_diagonal_calendar_spread_vs_sell_underlying_shuffle CombinationsTest.Put_diagonal_calendar_spread_vs_buy_underlying_direct CombinationsTest.Put_diagonal_calendar_spread_vs_buy_underlying_reverse CombinationsTest.Put_diagonal_calendar_spread_vs_buy_underlying_shuffle CombinationsTest.Put_diagonal_calendar_spread_vs_sell_underlying_direct CombinationsTest.Put_diagonal_calendar_spread_vs_sell_underlying_reverse CombinationsTest.Put_diagonal_calendar_spread_vs_sell_underlying_shuffle CombinationsTest.Guts_vs_buy_underlying_direct CombinationsTest.Guts_vs_buy_underlying_reverse CombinationsTest.Guts_vs_buy_underlying_shuffle CombinationsTest.Guts_vs_sell_underlying_direct CombinationsTest.Guts_vs_sell_underlying_reverse CombinationsTest.Guts_vs_sell_underlying_shuffle CombinationsTest.Call_butterfly_vs_buy_underlying_direct CombinationsTest.Call_butterfly_vs_buy_underlying_reverse CombinationsTest.Call_butterfly_vs_buy_underlying_shuffle CombinationsTest.Call_butterfly_vs_sell_underlying_direct CombinationsTest.Call_butterfly_vs_sell_underlying_reverse CombinationsTest.Call_butterfly_vs_sell_underlying_shuffle CombinationsTest.Put_butterfly_vs_buy_underlying_direct CombinationsTest.Put_butterfly_vs_buy_underlying_reverse CombinationsTest.Put_butterfly_vs_buy_underlying_shuffle CombinationsTest.Put_butterfly_vs_sell_underlying_direct CombinationsTest.Put_butterfly_vs_sell_underlying_reverse CombinationsTest.Put_butterfly_vs_sell_underlying_shuffle CombinationsTest.Iron_butterfly_vs_buy_underlying_direct CombinationsTest.Iron_butterfly_vs_buy_underlying_reverse CombinationsTest.Iron_butterfly_vs_buy_underlying_shuffle CombinationsTest.Iron_butterfly_vs_sell_underlying_direct CombinationsTest.Iron_butterfly_vs_sell_underlying_reverse CombinationsTest.Iron_butterfly_vs_sell_underlying_shuffle CombinationsTest.Diagonal_straddle_calendar_spread_vs_buy_underlying_direct CombinationsTest.Diagonal_straddle_calendar_spread_vs_buy_underlying_reverse CombinationsTest.Diagonal_straddle_calendar_spread_vs_buy_underlying_shuffle CombinationsTest.Diagonal_straddle_calendar_spread_vs_sell_underlying_direct CombinationsTest.Diagonal_straddle_calendar_spread_vs_sell_underlying_reverse CombinationsTest.Diagonal_straddle_calendar_spread_vs_sell_underlying_shuffle CombinationsTest.Call_condor_vs_buy_underlying_direct CombinationsTest.Call_condor_vs_buy_underlying_reverse CombinationsTest.Call_condor_vs_buy_underlying_shuffle CombinationsTest.Call_condor_vs_sell_underlying_direct CombinationsTest.Call_condor_vs_sell_underlying_reverse CombinationsTest.Call_condor_vs_sell_underlying_shuffle CombinationsTest.Put_condor_vs_buy_underlying_direct CombinationsTest.Put_condor_vs_buy_underlying_reverse CombinationsTest.Put_condor_vs_buy_underlying_shuffle CombinationsTest.Put_condor_vs_sell_underlying_direct CombinationsTest.Put_condor_vs_sell_underlying_reverse CombinationsTest.Put_condor_vs_sell_underlying_shuffle CombinationsTest.Iron_condor_vs_buy_underlying_direct CombinationsTest.Iron_condor_vs_buy_underlying_reverse CombinationsTest.Iron_condor_vs_buy_underlying_shuffle CombinationsTest.Iron_condor_vs_sell_underlying_direct CombinationsTest.Iron_condor_vs_sell_underlying_reverse CombinationsTest.Iron_condor_vs_sell_underlying_shuffle CombinationsTest.Fence_vs_sell_underlying_direct CombinationsTest.Fence_vs_sell_underlying_reverse CombinationsTest.Fence_vs_sell_underlying_shuffle CombinationsTest.Straddle_Fly_versus_Long_Underlying_direct CombinationsTest.Straddle_Fly_versus_Long_Underlying_reverse CombinationsTest.Straddle_Fly_versus_Long_Underlying_shuffle CombinationsTest.Straddle_Fly_versus_Short_Underlying_direct CombinationsTest.Straddle_Fly_versus_Short_Underlying_reverse CombinationsTest.Straddle_Fly_versus_Short_Underlying_shuffle CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_long_Underlying_direct CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_long_Underlying_reverse CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_long_Underlying_shuffle CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_short_Underlying_direct CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_short_Underlying_reverse CombinationsTest.2x3x2_Ratio_Call_Butterfly_versus_short_Underlying_shuffle CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Long_Underlying_direct CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Long_Underlying_reverse CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Long_Underlying_shuffle CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Short_Underlying_direct CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Short_Underlying_reverse CombinationsTest.2x3x2_Ratio_Put_Butterfly_versus_Short_Underlying_shuffle CombinationsTest.3x2_Ratio_Put_Spread_Long_Underlying_direct CombinationsTest.3x2_Ratio_Put_Spread_Long_Underlying_reverse CombinationsTest.3x2_Ratio_Put_Spread_Long_Underlying_shuffle CombinationsTest.3x2_Ratio_Put_Spread_Short_Underlying_direct CombinationsTest.3x2_Ratio_Put_Spread_Short_Underlying_reverse CombinationsTest.3x2_Ratio_Put_Spread_Short_Underlying_shuffle CombinationsTest.3x2_Ratio_Call_Spread_Long_Underlying_direct CombinationsTest.3x2_Ratio_Call_Spread_Long_Underlying_reverse CombinationsTest.3x2_Ratio_Call_Spread_Long_Underlying_shuffle CombinationsTest.3x2_Ratio_Call_Spread_Short_Underlying_direct CombinationsTest.3x2_Ratio_Call_Spread_Short_Underlying_reverse CombinationsTest.3x2_Ratio_Call_Spread_Short_Underlying_shuffle CombinationsTest.Call_Spread_Swap_versus_Long_Underlying_direct CombinationsTest.Call_Spread_Swap_versus_Long_Underlying_reverse CombinationsTest.Call_Spread_Swap_versus_Long_Underlying_shuffle CombinationsTest.Call_Spread_Swap_versus_Short_Underlying_direct CombinationsTest.Call_Spread_Swap_versus_Short_Underlying_reverse CombinationsTest.Call_Spread_Swap_versus_Short_Underlying_shuffle CombinationsTest.Put_Spread_Swap_versus_Long_Underlying_direct CombinationsTest.Put_Spread_Swap_versus_Long_Underlying_reverse CombinationsTest.Put_Spread_Swap_versus_Long_Underlying_shuffle CombinationsTest.Put_Spread_Swap_versus_Short_Underlying_direct CombinationsTest.Put_Spread_Swap_versus_Short_Underlying_reverse CombinationsTest.Put_Spread_Swap_versus_Short_Underlying_shuffle CombinationsTest.Risky_Swap_versus_Long_Underlying_direct CombinationsTest.Risky_Swap_versus_Long_Underlying_reverse CombinationsTest.Risky_Swap_versus_Long_Underlying_shuffle CombinationsTest.Risky_Swap_versus_Short_Underlying_direct CombinationsTest.Risky_Swap_versus_Short_Underlying_reverse CombinationsTest.Risky_Swap_versus_Short_Underlying_shuffle ProtocolTest.round_trip ProtocolTest.counts ProtocolTest.capture)
@@ -0,0 +1,86 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "FindGTest.cmake"
+  "Findpugixml.cmake"
+  "conan.cmake"
+  "/root/repo/libraries/CMakeLists.txt"
+  "/root/repo/libraries/combinations/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/combinations/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/main.dir/DependInfo.cmake"
+  "CMakeFiles/combinations-server.dir/DependInfo.cmake"
+  "CMakeFiles/combinations-client.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/pugixml_shim.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/combinations_core.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/combinations.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/embed.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/tests.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/etc.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/calibrate.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/decompose.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/replay.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/startup.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/load.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/scan.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/scale.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/adaptive.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/unclassified.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/traffic.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/generate.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/analyse.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/slowlog.dir/DependInfo.cmake"
+  "libraries/combinations/CMakeFiles/instances.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/combinations-client.dir/src/client.cpp.o"
+  "CMakeFiles/combinations-client.dir/src/client.cpp.o.d"
+  "combinations-client"
+  "combinations-client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/combinations-client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/combinations-server.dir/src/server.cpp.o"
+  "CMakeFiles/combinations-server.dir/src/server.cpp.o.d"
+  "combinations-server"
+  "combinations-server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/combinations-server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
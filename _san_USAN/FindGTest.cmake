@@ -0,0 +1,7 @@
+if(NOT TARGET GTest::GTest)
+  find_package(Threads REQUIRED)
+  add_library(GTest::GTest INTERFACE IMPORTED)
+  set_target_properties(GTest::GTest PROPERTIES INTERFACE_LINK_LIBRARIES "/usr/lib/x86_64-linux-gnu/libgtest_main.a;/usr/lib/x86_64-linux-gnu/libgtest.a;Threads::Threads")
+endif()
+set(GTest_FOUND TRUE)
+set(GTEST_FOUND TRUE)
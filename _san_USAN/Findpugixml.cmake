@@ -0,0 +1,6 @@
+if(NOT TARGET pugixml::pugixml)
+  add_library(pugixml_shim STATIC /tmp/gate/pugi/pugixml.cpp)
+  target_include_directories(pugixml_shim PUBLIC /tmp/gate/pugi)
+  add_library(pugixml::pugixml ALIAS pugixml_shim)
+endif()
+set(pugixml_FOUND TRUE)
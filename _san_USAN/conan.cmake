@@ -0,0 +1,6 @@
+function(conan_cmake_configure)
+endfunction()
+macro(conan_cmake_autodetect var)
+endmacro()
+function(conan_cmake_install)
+endfunction()
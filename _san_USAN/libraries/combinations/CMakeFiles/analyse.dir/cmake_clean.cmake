@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/analyse.dir/tools/analyse.cpp.o"
+  "CMakeFiles/analyse.dir/tools/analyse.cpp.o.d"
+  "analyse"
+  "analyse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/analyse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
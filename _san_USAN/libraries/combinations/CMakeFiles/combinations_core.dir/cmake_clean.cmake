@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/combinations_core.dir/src/Adaptive.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/Adaptive.cpp.o.d"
+  "CMakeFiles/combinations_core.dir/src/Analysis.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/Analysis.cpp.o.d"
+  "CMakeFiles/combinations_core.dir/src/Book.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/Book.cpp.o.d"
+  "CMakeFiles/combinations_core.dir/src/Cache.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/Cache.cpp.o.d"
+  "CMakeFiles/combinations_core.dir/src/Catalogue.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/Catalogue.cpp.o.d"
+  "CMakeFiles/combinations_core.dir/src/Combination.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/Combination.cpp.o.d"
+  "CMakeFiles/combinations_core.dir/src/Combinations.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/Combinations.cpp.o.d"
+  "CMakeFiles/combinations_core.dir/src/Component.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/Component.cpp.o.d"
+  "CMakeFiles/combinations_core.dir/src/DateTime.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/DateTime.cpp.o.d"
+  "CMakeFiles/combinations_core.dir/src/Input.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/Input.cpp.o.d"
+  "CMakeFiles/combinations_core.dir/src/Protocol.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/Protocol.cpp.o.d"
+  "CMakeFiles/combinations_core.dir/src/Signature.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/Signature.cpp.o.d"
+  "CMakeFiles/combinations_core.dir/src/SlowLog.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/SlowLog.cpp.o.d"
+  "CMakeFiles/combinations_core.dir/src/Stream.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/Stream.cpp.o.d"
+  "CMakeFiles/combinations_core.dir/src/Unclassifiable.cpp.o"
+  "CMakeFiles/combinations_core.dir/src/Unclassifiable.cpp.o.d"
+  "libcombinations_core.a"
+  "libcombinations_core.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/combinations_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
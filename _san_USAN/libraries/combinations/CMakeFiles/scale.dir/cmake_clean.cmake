@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scale.dir/benchmarks/scale.cpp.o"
+  "CMakeFiles/scale.dir/benchmarks/scale.cpp.o.d"
+  "scale"
+  "scale.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scale.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scan.dir/benchmarks/scan.cpp.o"
+  "CMakeFiles/scan.dir/benchmarks/scan.cpp.o.d"
+  "scan"
+  "scan.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
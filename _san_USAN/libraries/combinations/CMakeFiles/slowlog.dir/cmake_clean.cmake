@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/slowlog.dir/tools/slowlog.cpp.o"
+  "CMakeFiles/slowlog.dir/tools/slowlog.cpp.o.d"
+  "slowlog"
+  "slowlog.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slowlog.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests.dir/tests/load_test.cpp.o"
+  "CMakeFiles/tests.dir/tests/load_test.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test.cpp.o"
+  "CMakeFiles/tests.dir/tests/test.cpp.o.d"
+  "tests"
+  "tests.pdb"
+  "tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unclassified.dir/benchmarks/unclassified.cpp.o"
+  "CMakeFiles/unclassified.dir/benchmarks/unclassified.cpp.o.d"
+  "unclassified"
+  "unclassified.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unclassified.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,90 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "combinations/Combinations.hpp"
+#include "combinations/Component.hpp"
+#include "synthetic.hpp"
+
+// Replays a skewed workload through classify in priority order and in adaptive order on a synthetic resource of the
+// given number of types made of venue variants of the types of the XML resource: most inputs are of a few types late in
+// priority order, the rest of other types or of none. Both orders have to return the same names
+
+namespace {
+
+const std::size_t inputs = 200000, hot_percent = 90;
+
+std::vector<Component> make_input(const std::vector<std::string>& legs) {
+    std::vector<Component> components;
+    for (const auto& leg : legs) {
+        components.push_back(Component::from_string(leg));
+    }
+    return components;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    std::ifstream source_file(argc > 1 ? argv[1] : "etc/combinations.xml");
+    std::stringstream source;
+    source << source_file.rdbuf();
+    const auto types = argc > 2 ? std::stoul(argv[2]) : 10000;
+
+    const std::vector<std::vector<Component>> hot = {
+        make_input({"C 1 2100 2010-03-01", "P 1 2100 2010-03-01"}),
+        make_input({"C 1 2200 2010-03-01", "P 1 2100 2010-03-01"}),
+        make_input({"C -1 2100 2010-03-01", "C 1 2100 2010-04-01"}),
+        make_input({"P -1 2100 2010-03-01", "P 1 2100 2010-04-01"}),
+    };
+    const std::vector<std::vector<Component>> cold = {
+        make_input({"F 1 2010-03-01", "F -1 2010-04-01"}),
+        make_input({"C 1 2100 2010-03-01", "C -1 2200 2010-03-01"}),
+        make_input({"C 1 2100 2010-03-01", "C -2 2200 2010-03-01", "C 1 2300 2010-03-01"}),
+        make_input({"C 1 2100 2010-03-01", "C 1 2200 2010-04-01", "C 5 2300 2010-05-01"}),
+        make_input({"C 1 2100 2010-03-01", "P 2 2100 2010-03-01"}),
+    };
+    std::mt19937_64 gen(42);
+    std::vector<const std::vector<Component>*> workload;
+    for (std::size_t i = 0; i < inputs; ++i) {
+        workload.push_back(gen() % 100 < hot_percent ? &hot[gen() % hot.size()] : &cold[gen() % cold.size()]);
+    }
+
+    const auto resource = synthesize(source.str(), types);
+    if (resource.empty()) {
+        std::cerr << "Malformed combination element in the resource" << std::endl;
+        return 1;
+    }
+    Combinations combinations;
+    if (!combinations.load(std::span<const char>(resource))) {
+        std::cerr << "Failed to load the synthetic resource of " << types << " types" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> names[2];
+    std::cout << "types: " << types << ", inputs: " << inputs << ", hot: " << hot_percent << '%' << std::endl;
+    for (const bool adaptive : {false, true}) {
+        combinations.set_adaptive(adaptive);
+        std::size_t evaluated = 0;
+        std::vector<int> order;
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto* components : workload) {
+            Budget budget;
+            const auto result = combinations.classify(*components, order, budget);
+            evaluated += result.evaluated;
+            names[adaptive].push_back(result.name);
+        }
+        const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << (adaptive ? "adaptive" : "priority") << ": " << elapsed.count() / inputs << " us/input, "
+                  << static_cast<double>(evaluated) / inputs << " checked/input" << std::endl;
+    }
+    if (names[0] != names[1]) {
+        std::cerr << "Adaptive order changed a result" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+#include "combinations/Combination.hpp"
+#include "combinations/Component.hpp"
+
+// Times the permutation and backtracking engines of Multiple per number of legs, the largest size where brute force
+// still wins is the permutation_limit constant in Combination.cpp
+
+namespace {
+
+const std::size_t max_legs = 8, repeats = 2000;
+
+// Futures with strictly increasing expirations and alternating ratio signs
+std::vector<Leg> make_legs(std::size_t size) {
+    std::vector<Leg> legs;
+    for (std::size_t j = 0; j < size; ++j) {
+        Leg leg{};
+        leg.type  = InstrumentType::F;
+        leg.mask  = Leg::bit(InstrumentType::F);
+        leg.sign  = true;
+        leg.ratio = j % 2 == 0 ? 1 : -1;
+        if (j > 0) {
+            leg.expiration_kind = Leg::Offset;
+            leg.expiration      = static_cast<std::int32_t>(j);
+        }
+        legs.push_back(leg);
+    }
+    return legs;
+}
+
+std::vector<Component> make_components(std::size_t size, bool valid, std::mt19937_64& gen) {
+    std::vector<Component> components(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        components[i].type               = InstrumentType::F;
+        components[i].ratio              = i % 2 == 0 ? 1 : -1;
+        components[i].expiration.tm_year = 110;
+        components[i].expiration.tm_mon  = 2;
+        components[i].expiration.tm_mday = static_cast<int>(i) + 1;
+    }
+    if (!valid) {
+        components.back().expiration.tm_mday = 1;
+    }
+    std::shuffle(components.begin(), components.end(), gen);
+    return components;
+}
+
+template <class Engine>
+double measure(const std::vector<Input>& inputs, Engine engine) {
+    std::vector<int> order;
+    Budget budget;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t r = 0; r < repeats; ++r) {
+        for (const auto& input : inputs) {
+            order.resize(input.size());
+            engine(input, order, budget);
+        }
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / static_cast<double>(repeats * inputs.size());
+}
+
+}  // anonymous namespace
+
+int main() {
+    std::mt19937_64 gen(42);
+    std::size_t limit = 1;
+
+    std::cout << "legs\tpermutation, ns\tbacktracking, ns" << std::endl;
+    for (std::size_t size = 2; size <= max_legs; ++size) {
+        const auto legs = make_legs(size);
+        Fixed fixed(legs, "Calibration", 1);
+        const auto valid = make_components(size, true, gen), invalid = make_components(size, false, gen);
+        const std::vector<Input> inputs{Input(valid), Input(invalid)};
+
+        const auto permutation =
+            measure(inputs, [&fixed](const auto& c, auto& o, auto& b) { return fixed.permute(c, o, b); });
+        const auto backtracking =
+            measure(inputs, [&fixed](const auto& c, auto& o, auto& b) { return fixed.backtrack(c, o, b); });
+        std::cout << size << '\t' << permutation << '\t' << backtracking << std::endl;
+        if (permutation < backtracking && limit + 1 == size) {
+            limit = size;
+        }
+    }
+    std::cout << "permutation_limit = " << limit << std::endl;
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <random>
+
+#include "combinations/Combinations.hpp"
+#include "combinations/Component.hpp"
+
+// Times the decomposition of a large random book into combinations, takes the catalogue path as its argument
+
+namespace {
+
+const std::size_t book_size = 100000, expirations = 12, strikes = 50;
+
+std::vector<Component> make_book(std::mt19937_64& gen) {
+    const InstrumentType types[] = {InstrumentType::C, InstrumentType::P, InstrumentType::F, InstrumentType::U};
+    const double ratios[]        = {1, -1, 2, -2};
+    std::uniform_int_distribution<std::size_t> type(0, 3), ratio(0, 3), expiration(0, expirations - 1),
+        strike(1, strikes);
+
+    std::vector<Component> book(book_size);
+    for (auto& component : book) {
+        component.type               = types[type(gen)];
+        component.ratio              = ratios[ratio(gen)];
+        const auto month             = static_cast<int>(expiration(gen));
+        component.expiration.tm_year = 110 + month / 12;
+        component.expiration.tm_mon  = month % 12;
+        component.expiration.tm_mday = 15;
+        if (component.type == InstrumentType::C || component.type == InstrumentType::P) {
+            component.strike = 10.0 * static_cast<double>(strike(gen));
+        }
+    }
+    return book;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    Combinations combinations;
+    if (!combinations.load(argc > 1 ? argv[1] : "etc/combinations.xml")) {
+        std::cerr << "Failed to load the catalogue" << std::endl;
+        return 1;
+    }
+    std::mt19937_64 gen(42);
+    const auto book = make_book(gen);
+
+    const auto start         = std::chrono::steady_clock::now();
+    const auto decomposition = combinations.decompose(book);
+    const auto elapsed       = std::chrono::steady_clock::now() - start;
+
+    std::map<std::string, std::size_t> histogram;
+    for (const auto& part : decomposition.parts) {
+        ++histogram[part.name];
+    }
+    for (const auto& [name, count] : histogram) {
+        std::cout << name << '\t' << count << std::endl;
+    }
+    std::cout << "legs: " << book.size() << ", combinations: " << decomposition.parts.size()
+              << ", leftover: " << decomposition.leftover.size()
+              << ", time: " << std::chrono::duration<double, std::milli>(elapsed).count() << " ms" << std::endl;
+    return 0;
+}
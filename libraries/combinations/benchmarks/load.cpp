@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "combinations/Combinations.hpp"
+#include "pugixml.hpp"
+#include "synthetic.hpp"
+
+// Times loading a synthetic resource of many types made of variants of the types of the XML resource given as the
+// argument: parsing it with load_file and the default flags as load did before, and the whole load from a file and
+// from memory
+
+namespace {
+
+const std::size_t types = 10000, repeats = 20;
+
+template <typename... Args>
+int fail(Args &&...args) noexcept {
+    ((std::cerr << args), ...);
+    std::cerr << std::endl;
+    return 1;
+}
+
+template <class Load>
+void measure(const char *title, Load load) {
+    std::vector<double> times;
+    for (std::size_t r = 0; r < repeats; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        if (!load()) {
+            std::cout << title << "\tfailed" << std::endl;
+            return;
+        }
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        times.push_back(elapsed.count());
+    }
+    std::sort(times.begin(), times.end());
+    std::cout << title << '\t' << times.front() << '\t' << times[times.size() / 2] << std::endl;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    std::ifstream source_file(argc > 1 ? argv[1] : "etc/combinations.xml");
+    std::stringstream source;
+    source << source_file.rdbuf();
+    const auto resource = synthesize(source.str(), types);
+    if (resource.empty()) {
+        return fail("Malformed combination element in the resource");
+    }
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "combinations-load.xml";
+    std::ofstream(path) << resource;
+    if (resource.size() < 100 || std::filesystem::file_size(path) != resource.size()) {
+        return fail("Failed to make a resource at ", path);
+    }
+
+    std::cout << "resource: " << types << " types, " << resource.size() << " bytes" << std::endl;
+    std::cout << "load\tmin, ms\tmedian, ms" << std::endl;
+    measure("parse load_file", [&path] {
+        pugi::xml_document doc;
+        return static_cast<bool>(doc.load_file(path.c_str()));
+    });
+    measure("load path", [&path] { return Combinations().load(path); });
+    measure("load buffer", [&resource] { return Combinations().load(std::span<const char>(resource)); });
+
+    std::filesystem::remove(path);
+    return 0;
+}
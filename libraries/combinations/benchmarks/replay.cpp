@@ -0,0 +1,116 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <tuple>
+
+#include "combinations/Combinations.hpp"
+#include "combinations/Component.hpp"
+#include "combinations/Stream.hpp"
+
+// Replays a recorded event file through a Stream, one event per line: time in microseconds, order id, number of legs
+// of the order and the leg as the combinations tool reads it. Given a number of orders, records a random file first
+
+namespace {
+
+const std::size_t interleaved = 64, capacity = 4096;
+const auto timeout            = std::chrono::milliseconds(100);
+
+template <typename... Args>
+int fail(Args &&...args) noexcept {
+    ((std::cerr << args), ...);
+    std::cerr << std::endl;
+    return 1;
+}
+
+std::string make_leg(std::mt19937_64 &gen) {
+    const char *types[]   = {"C", "P", "F", "U"};
+    const char *ratios[]  = {"1", "-1", "2", "-2"};
+    const char *strikes[] = {"2000", "2100", "2200"};
+    const char *dates[]   = {"2010-03-01", "2010-04-01", "2010-05-01"};
+
+    std::string type = types[gen() % 4];
+    std::string leg  = type + ' ' + ratios[gen() % 4] + ' ';
+    if (type == "C" || type == "P") {
+        leg += std::string(strikes[gen() % 3]) + ' ';
+    }
+    return leg + dates[gen() % 3];
+}
+
+// Legs of interleaved orders, one in ten orders loses its last leg
+void record(const std::string &path, std::size_t orders) {
+    struct Order {
+        std::uint64_t id;
+        std::size_t legs, sent;
+    };
+    std::mt19937_64 gen(42);
+    std::ofstream file(path);
+    std::vector<Order> active;
+    std::uint64_t next_id = 0, time = 0;
+    while (next_id < orders || !active.empty()) {
+        while (active.size() < interleaved && next_id < orders) {
+            active.push_back({next_id++, 2 + gen() % 3, 0});
+        }
+        const auto i = gen() % active.size();
+        auto &order  = active[i];
+        file << (time += gen() % 20) << ' ' << order.id << ' ' << order.legs << ' ' << make_leg(gen) << '\n';
+        if (++order.sent == order.legs || (order.sent + 1 == order.legs && order.id % 10 == 0)) {
+            active[i] = active.back();
+            active.pop_back();
+        }
+    }
+}
+
+}  // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    if (argc != 3 && argc != 4) {
+        return fail("Usage: replay <combinations XML resource> <event file> [number of orders to record]");
+    }
+    Combinations combinations;
+    if (!combinations.load(argv[1])) {
+        return fail("Failed to load combinations XML resource from ", argv[1]);
+    }
+    if (argc == 4) {
+        record(argv[2], std::stoul(argv[3]));
+    }
+
+    std::ifstream file(argv[2]);
+    std::vector<std::tuple<std::uint64_t, std::uint64_t, std::size_t, Component>> events;
+    std::uint64_t time, id;
+    std::size_t legs;
+    while (file >> time >> id >> legs) {
+        events.emplace_back(time, id, legs, Component::from_stream(file));
+        if (std::get<Component>(events.back()).type == InstrumentType::Unknown) {
+            return fail("Failed to read event ", events.size());
+        }
+    }
+
+    Stream stream(combinations, timeout, capacity);
+    std::size_t statuses[3] = {}, classified = 0;
+    const auto drain        = [&] {
+        while (const auto result = stream.next()) {
+            ++statuses[static_cast<int>(result->status)];
+            classified += result->name != "Unclassified";
+        }
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto &[micros, order, size, component] : events) {
+        const Stream::Clock::time_point at{std::chrono::microseconds(micros)};
+        stream.push(order, size, component, at);
+        stream.expire(at);
+        drain();
+    }
+    stream.flush();
+    drain();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "events: " << events.size() << ", complete: " << statuses[0] << ", timeout: " << statuses[1]
+              << ", evicted: " << statuses[2] << ", dropped: " << stream.dropped() << ", classified: " << classified
+              << std::endl;
+    std::cout << "time: " << elapsed.count() * 1000 << " ms, " << static_cast<double>(events.size()) / elapsed.count()
+              << " events/s" << std::endl;
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "combinations/Combinations.hpp"
+#include "combinations/Component.hpp"
+#include "synthetic.hpp"
+
+// Times load and classify on synthetic resources of a growing number of types made of venue variants of the types of
+// the XML resource given as the argument. Classify is timed on a type found first among its variants, on an input
+// looked up among the variants of a type without a match and on one no type admits
+
+namespace {
+
+const std::size_t load_repeats = 5, classify_repeats = 2000;
+const std::size_t sizes[]      = {126, 1000, 10000, 50000};
+
+template <class Run>
+double median(std::size_t repeats, Run run) {
+    std::vector<double> times;
+    for (std::size_t r = 0; r < repeats; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        times.push_back(elapsed.count());
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+std::vector<Component> make_input(const std::vector<std::string>& legs) {
+    std::vector<Component> components;
+    for (const auto& leg : legs) {
+        components.push_back(Component::from_string(leg));
+    }
+    return components;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    std::ifstream source_file(argc > 1 ? argv[1] : "etc/combinations.xml");
+    std::stringstream source;
+    source << source_file.rdbuf();
+
+    const std::vector<std::pair<const char*, std::vector<Component>>> inputs = {
+        {"classified", make_input({"F 1 2010-03-01", "F -1 2010-04-01"})},
+        {"unclassified", make_input({"C 1 2100 2010-03-01", "C 1 2200 2010-04-01", "C 5 2300 2010-05-01"})},
+        {"no candidate", make_input({"U 1 2010-03-01", "U 1 2010-04-01", "U 1 2010-05-01", "F 1 2010-06-01"})},
+    };
+
+    std::cout << "types\tload, ms";
+    for (const auto& [title, components] : inputs) {
+        std::cout << '\t' << title << ", us\tchecked";
+    }
+    std::cout << std::endl;
+
+    for (const auto types : sizes) {
+        const auto resource = synthesize(source.str(), types);
+        if (resource.empty()) {
+            std::cerr << "Malformed combination element in the resource" << std::endl;
+            return 1;
+        }
+        Combinations combinations;
+        const auto load = median(load_repeats, [&] { Combinations().load(std::span<const char>(resource)); });
+        if (!combinations.load(std::span<const char>(resource))) {
+            std::cout << types << "\tfailed" << std::endl;
+            continue;
+        }
+
+        std::cout << types << '\t' << load / 1000;
+        for (const auto& [title, components] : inputs) {
+            std::vector<int> order;
+            Classification result;
+            const auto latency = median(classify_repeats, [&] {
+                Budget budget;
+                result = combinations.classify(components, order, budget);
+            });
+            std::cout << '\t' << latency << '\t' << result.evaluated;
+        }
+        std::cout << std::endl;
+    }
+    return 0;
+}
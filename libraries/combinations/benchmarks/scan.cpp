@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "combinations/Catalogue.hpp"
+#include "combinations/Combination.hpp"
+#include "combinations/Combinations.hpp"
+#include "combinations/Component.hpp"
+#include "combinations/Input.hpp"
+
+// Times a scan over every type of the XML resource given as the argument for an input none of them matches: through
+// matchers allocated one by one and called by their virtual checks, through the entries of the catalogue checked on
+// their kind with the matchers called only for the types the entries admit, and classify itself
+
+namespace {
+
+const std::size_t samples = 50, scans = 1000;
+
+template <typename... Args>
+int fail(Args &&...args) noexcept {
+    ((std::cerr << args), ...);
+    std::cerr << std::endl;
+    return 1;
+}
+
+template <class Scan>
+void measure(const char *title, Scan scan) {
+    std::vector<double> times;
+    std::size_t checked = 0;
+    for (std::size_t s = 0; s < samples; ++s) {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < scans; ++i) {
+            checked += scan();
+        }
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        times.push_back(elapsed.count() / scans);
+    }
+    std::sort(times.begin(), times.end());
+    std::cout << title << '\t' << times.front() << '\t' << times[times.size() / 2] << '\t'
+              << checked / (samples * scans) << std::endl;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    const std::filesystem::path path{argc > 1 ? argv[1] : "etc/combinations.xml"};
+    Combinations combinations;
+    if (!combinations.load(path)) {
+        return fail("Failed to load combinations XML resource from ", path);
+    }
+    const auto image = combinations.image();  // the entries and the matchers point into it
+    std::vector<Catalogue::Entry> entries;
+    if (!Catalogue::read(image, entries)) {
+        return fail("Failed to read the catalogue image of ", path);
+    }
+
+    std::vector<std::unique_ptr<Combination>> matchers;
+    for (const auto &entry : entries) {
+        switch (entry.kind) {
+        case Catalogue::Kind::Fixed:
+            matchers.emplace_back(new Fixed(entry.legs, entry.name, entry.unit));
+            break;
+        case Catalogue::Kind::Chain:
+            matchers.emplace_back(new Chain(entry.legs, entry.name, entry.unit));
+            break;
+        case Catalogue::Kind::Multiple:
+            matchers.emplace_back(new Multiple(entry.legs, entry.name, entry.unit));
+            break;
+        case Catalogue::Kind::More:
+            matchers.emplace_back(new More(entry.legs.front(), entry.name, entry.unit, entry.min_count));
+            break;
+        }
+    }
+
+    const std::vector<Component> components = {
+        Component::from_string("U 1 2010-03-01"),
+        Component::from_string("U 1 2010-04-01"),
+        Component::from_string("F 1 2010-05-01"),
+        Component::from_string("C 1 2100 2010-05-01"),
+    };
+    std::vector<int> order(components.size());
+    if (combinations.classify(components, order) != "Unclassified") {
+        return fail("The input is classified");
+    }
+    const Input input(components);
+    Signature signature;
+    for (const auto &component : components) {
+        signature.add(component.type);
+    }
+
+    std::cout << entries.size() << " types" << std::endl;
+    std::cout << "scan\tmin, ns\tmedian, ns\tchecked" << std::endl;
+    measure("virtual", [&] {
+        Budget budget;
+        for (const auto &matcher : matchers) {
+            if (matcher->check(input, order, budget)) {
+                break;
+            }
+        }
+        return matchers.size();
+    });
+    measure("entries", [&] {
+        Budget budget;
+        std::size_t checked = 0;
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            if (Catalogue::admits(entries[i], signature)) {
+                ++checked;
+                if (matchers[i]->check(input, order, budget)) {
+                    break;
+                }
+            }
+        }
+        return checked;
+    });
+    measure("classify", [&] {
+        Budget budget;
+        return combinations.classify(components, order, budget).evaluated;
+    });
+    return 0;
+}
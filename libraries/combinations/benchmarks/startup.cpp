@@ -0,0 +1,56 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "combinations/Catalogue.hpp"
+#include "combinations/Combinations.hpp"
+#include "combinations/Component.hpp"
+
+// Times a start from nothing to the first classification: loading the XML resource given as the argument, the
+// catalogue built into the library and a shared catalogue
+
+namespace {
+
+const std::size_t repeats = 200;
+const std::string shared  = "/combinations-startup";
+
+template <class Load>
+void measure(const char* title, Load load) {
+    const std::vector<Component> components = {
+        Component::from_string("F 1 2010-03-01"),
+        Component::from_string("F -1 2010-04-01"),
+    };
+    std::vector<double> times;
+    for (std::size_t r = 0; r < repeats; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        Combinations combinations;
+        std::vector<int> order;
+        if (!load(combinations) || combinations.classify(components, order) == "Unclassified") {
+            std::cout << title << "\tfailed" << std::endl;
+            return;
+        }
+        const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        times.push_back(elapsed.count());
+    }
+    std::sort(times.begin(), times.end());
+    std::cout << title << '\t' << times.front() << '\t' << times[times.size() / 2] << std::endl;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    const std::filesystem::path path{argc > 1 ? argv[1] : "etc/combinations.xml"};
+
+    std::cout << "source\tmin, us\tmedian, us" << std::endl;
+    measure("xml", [&path](Combinations& combinations) { return combinations.load(path); });
+    measure("builtin", [](Combinations& combinations) { return combinations.load_builtin(); });
+
+    Combinations publisher;
+    if (publisher.load(path) && publisher.share(shared)) {
+        measure("shared", [](Combinations& combinations) { return combinations.attach(shared); });
+        Catalogue::remove(shared);
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "combinations/Combinations.hpp"
+#include "combinations/Protocol.hpp"
+
+// Replays a capture recorded by combinations --record through classify, as fast as possible or with --paced at the
+// times the inputs were recorded. Reports the throughput, the latency distribution of every type returned and a
+// checksum of the names and orders, which has to stay the same across optimisations
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename... Args>
+int fail(Args &&...args) noexcept {
+    ((std::cerr << args), ...);
+    std::cerr << std::endl;
+    return 1;
+}
+
+// FNV-1a, over the bytes of the value
+template <class T>
+void mix(std::uint64_t &checksum, const T &value) {
+    for (const auto byte : std::string_view(reinterpret_cast<const char *>(&value), sizeof(value))) {
+        checksum = (checksum ^ static_cast<unsigned char>(byte)) * 0x100000001b3;
+    }
+}
+
+double percentile(const std::vector<double> &sorted, double fraction) {
+    return sorted[std::min(sorted.size() - 1, static_cast<std::size_t>(fraction * static_cast<double>(sorted.size())))];
+}
+
+}  // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    const bool paced = argc == 4 && std::string_view(argv[3]) == "--paced";
+    if (argc != 3 && !paced) {
+        return fail("Usage: traffic <combinations XML resource> <capture> [--paced]");
+    }
+    Combinations combinations;
+    if (!combinations.load(std::filesystem::path{argv[1]})) {
+        return fail("Failed to load combinations XML resource from ", argv[1]);
+    }
+    std::ifstream file(argv[2], std::ios::binary);
+    const std::string data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    std::vector<Captured> inputs;
+    for (const auto message : Frame::messages(data)) {
+        auto captured = Captured::decode(message);
+        if (!captured) {
+            return fail("Failed to read record ", inputs.size());
+        }
+        inputs.push_back(std::move(*captured));
+    }
+    if (inputs.empty()) {
+        return fail("No inputs captured in ", argv[2]);
+    }
+
+    std::map<std::string, std::vector<double>> latencies;  // in microseconds by the name returned
+    std::uint64_t checksum = 0xcbf29ce484222325;
+    const auto start       = Clock::now();
+    for (const auto &input : inputs) {
+        if (paced) {
+            std::this_thread::sleep_until(start + std::chrono::microseconds(input.microseconds));
+        }
+        std::vector<int> order;
+        const auto begin   = Clock::now();
+        const auto name    = combinations.classify(input.components, order);
+        const auto elapsed = Clock::now() - begin;
+        latencies[name].push_back(std::chrono::duration<double, std::micro>(elapsed).count());
+        for (const auto c : name) {
+            mix(checksum, c);
+        }
+        for (const auto position : order) {
+            mix(checksum, position);
+        }
+    }
+    const std::chrono::duration<double> total = Clock::now() - start;
+
+    std::cout << "inputs: " << inputs.size() << ", " << static_cast<double>(inputs.size()) / total.count()
+              << " inputs/s" << (paced ? " paced" : "") << ", checksum: " << std::hex << checksum << std::dec
+              << std::endl;
+    std::cout << "type\tcount\tp50, us\tp90, us\tp99, us\tmax, us" << std::endl;
+    for (auto &[name, times] : latencies) {
+        std::sort(times.begin(), times.end());
+        std::cout << name << '\t' << times.size() << '\t' << percentile(times, 0.5) << '\t' << percentile(times, 0.9)
+                  << '\t' << percentile(times, 0.99) << '\t' << times.back() << std::endl;
+    }
+    return 0;
+}
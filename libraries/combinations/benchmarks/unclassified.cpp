@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "combinations/Combinations.hpp"
+#include "combinations/Component.hpp"
+
+// Replays a workload where a third of the inputs are of a few shapes no type matches, their components shuffled,
+// through classify without and with the filter of unclassified inputs. Both have to return the same names
+
+namespace {
+
+const std::size_t inputs = 200000, unclassified_percent = 33;
+
+std::vector<Component> make_input(const std::vector<std::string>& legs) {
+    std::vector<Component> components;
+    for (const auto& leg : legs) {
+        components.push_back(Component::from_string(leg));
+    }
+    return components;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    Combinations combinations;
+    if (!combinations.load(argc > 1 ? argv[1] : "etc/combinations.xml")) {
+        std::cerr << "Failed to load combinations XML resource" << std::endl;
+        return 1;
+    }
+
+    const std::vector<std::vector<Component>> classified = {
+        make_input({"C 1 2100 2010-03-01", "P 1 2100 2010-03-01"}),
+        make_input({"F 1 2010-03-01", "F -1 2010-04-01"}),
+        make_input({"C 1 2100 2010-03-01", "C -2 2200 2010-03-01", "C 1 2300 2010-03-01"}),
+        make_input({"C 1 2100 2010-03-01", "C -1 2200 2010-03-01", "P 1 2100 2010-03-01", "P -1 2200 2010-03-01"}),
+    };
+    const std::vector<std::vector<Component>> unclassified = {
+        make_input({"C 1 2100 2010-03-01", "C 1 2200 2010-04-01", "C 5 2300 2010-05-01"}),
+        make_input({"C 1 2100 2010-03-01", "C -1 2200 2010-03-01", "C 1 2300 2010-03-01", "C -1 2500 2010-03-01"}),
+        make_input({"P 1 2100 2010-03-01", "P -3 2200 2010-03-01", "P 3 2300 2010-03-01", "P -1 2400 2010-03-01"}),
+        make_input({"F 1 2010-03-01", "F -1 2010-04-01", "C 1 2100 2010-03-01", "P 2 2100 2010-03-01"}),
+    };
+    std::mt19937_64 gen(42);
+    std::vector<std::vector<Component>> workload;
+    for (std::size_t i = 0; i < inputs; ++i) {
+        const auto& shapes = gen() % 100 < unclassified_percent ? unclassified : classified;
+        auto components    = shapes[gen() % shapes.size()];
+        std::shuffle(components.begin(), components.end(), gen);
+        workload.push_back(std::move(components));
+    }
+
+    std::vector<std::string> names[2];
+    std::cout << "inputs: " << inputs << ", unclassified: " << unclassified_percent << '%' << std::endl;
+    for (const bool filter : {false, true}) {
+        combinations.set_unclassified_filter(filter);
+        std::size_t evaluated = 0;
+        std::vector<int> order;
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto& components : workload) {
+            Budget budget;
+            const auto result = combinations.classify(components, order, budget);
+            evaluated += result.evaluated;
+            names[filter].push_back(result.name);
+        }
+        const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << (filter ? "filter" : "no filter") << ": " << elapsed.count() / inputs << " us/input, "
+                  << static_cast<double>(evaluated) / inputs << " checked/input" << std::endl;
+    }
+    if (names[0] != names[1]) {
+        std::cerr << "The filter changed a result" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+#ifndef COMBINATIONS_ADAPTIVE_HPP
+#define COMBINATIONS_ADAPTIVE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "combinations/Analysis.hpp"
+#include "combinations/Catalogue.hpp"
+#include "combinations/Signature.hpp"
+
+// Order of the candidates of every signature adapted to the traffic: the types classified most often are checked first,
+// each moved only past earlier types exclusive with it, so the first match is still the one of priority order. Every
+// classification is counted and the orders are redone once per period, a classify keeps the order it took meanwhile.
+// The classify completing a period redoes them outside the lock of the walks, the others keep the previous orders
+class Adaptive {
+public:
+    static constexpr std::uint64_t period = 4096;  // classifications between reorders
+
+    Adaptive(const std::vector<Catalogue::Entry>& entries, const Analysis& analysis);
+
+    // Order of the signature, nullptr until it is added
+    std::shared_ptr<const std::vector<std::size_t>> find(const Signature& signature) const;
+    // Adds the signature with its candidates in priority order, shadowed types are left out
+    std::shared_ptr<const std::vector<std::size_t>> add(const Signature& signature,
+                                                        const std::vector<std::size_t>& candidates);
+
+    // Counts a classification as a hit of the type or of none
+    void count(std::size_t type);
+
+private:
+    struct Walk {
+        std::vector<std::size_t> types;               // in priority order
+        std::vector<std::vector<std::size_t>> later;  // positions of the types that stay after each one
+        std::vector<std::size_t> earlier;             // number of types each one stays after
+        std::shared_ptr<const std::vector<std::size_t>> order;
+    };
+
+    // Order of the walk by the hits so far
+    std::shared_ptr<const std::vector<std::size_t>> order(const Walk& walk) const;
+    // Redoes the orders of the walks, one at a time
+    void reorder();
+
+    const std::vector<Catalogue::Entry>& entries;
+    const Analysis& analysis;
+    const std::unique_ptr<std::atomic<std::uint64_t>[]> hits;  // by type position
+    std::atomic<std::uint64_t> classifications{0};
+    mutable std::mutex mutex;  // of the walks and their orders, the rest of a walk does not change once added
+    std::mutex reordering;     // held by the one reorder running
+    std::map<Signature, Walk> walks;
+};
+
+#endif  // COMBINATIONS_ADAPTIVE_HPP
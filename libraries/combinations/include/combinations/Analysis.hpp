@@ -0,0 +1,68 @@
+#ifndef COMBINATIONS_ANALYSIS_HPP
+#define COMBINATIONS_ANALYSIS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "combinations/Catalogue.hpp"
+#include "combinations/Input.hpp"
+#include "combinations/Signature.hpp"
+#include "combinations/Tolerance.hpp"
+
+// What a type asks of an input as a whole, known before any order is tried. By component type, per block of legs: the
+// number of legs, of those with a positive ratio and of those matching by value with the sum and the smallest
+// magnitude of their ratios in steps. A More is one leg for every component. A type of a single block also bounds the
+// numbers of distinct strikes and expirations
+struct Profile {
+    struct Range {
+        int min, max;
+    };
+
+    static Profile of(const Catalogue::Entry& entry);
+
+    // False when no order of the input can match the type
+    bool admits(const Input& input) const;
+    // No input within the tolerance matches both types, given that some signature is admitted by both
+    bool excludes(const Profile& other, const Tolerance& tolerance) const;
+
+    std::array<std::int32_t, Signature::types> legs{};
+    std::array<std::int32_t, Signature::types> positives{};
+    std::array<std::int32_t, Signature::types> values{};
+    std::array<std::int64_t, Signature::types> sums{};
+    std::array<std::int64_t, Signature::types> smallest{};
+    std::int64_t unit = 1;
+    std::optional<Range> strikes, expirations;
+
+private:
+    // The sign of every ratio of the type is certain within the epsilon
+    bool decisive(std::size_t type, std::int64_t epsilon, std::int64_t unit) const;
+};
+
+// Load-time pass over the types in priority order: which are shadowed, matching nothing an earlier type does not match
+// as well, and which pairs are exclusive, no input matching both. Shadowed types can never be the first match and
+// exclusive types can be checked in any order between them
+struct Analysis {
+    static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+    Analysis() = default;
+    Analysis(const std::vector<Catalogue::Entry>& entries, const Tolerance& tolerance);
+
+    // Of the entries analysed, by position
+    bool exclusive(const std::vector<Catalogue::Entry>& entries, std::size_t a, std::size_t b) const;
+
+    std::vector<Profile> profiles;
+    std::vector<std::size_t> shadowed;  // position of an earlier type matching everything the type matches, or none
+
+private:
+    // Every input matching b matches a
+    bool covers(const Catalogue::Entry& a, const Catalogue::Entry& b) const;
+    bool covers(const Leg& a, std::int64_t a_unit, const Leg& b, std::int64_t b_unit) const;
+
+    Tolerance tolerance;
+};
+
+#endif  // COMBINATIONS_ANALYSIS_HPP
@@ -0,0 +1,38 @@
+#ifndef COMBINATIONS_BOOK_HPP
+#define COMBINATIONS_BOOK_HPP
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "combinations/Component.hpp"
+#include "combinations/DateTime.hpp"
+#include "combinations/Input.hpp"
+#include "combinations/Tolerance.hpp"
+
+// Large set of components being split into combinations, indexed by instrument type, expiration and strike
+struct Book {
+    explicit Book(const std::vector<Component>& components, const Tolerance& tolerance = {});
+
+    // Value constraint of one leg, low and high are exclusive
+    template <class T>
+    struct Bounds {
+        std::optional<T> exact;
+        std::optional<T> low;
+        std::optional<T> high;
+    };
+
+    // Components of the type within the expiration bounds and, for an exact expiration, within the strike bounds
+    std::span<const int> find(InstrumentType type, const Bounds<Expiration>& expiration,
+                              const Bounds<std::int64_t>& strike) const;
+
+    const Input input;
+    std::vector<bool> used;
+
+private:
+    std::map<InstrumentType, std::vector<int>> index;  // sorted by expiration, strike and position
+};
+
+#endif  // COMBINATIONS_BOOK_HPP
@@ -0,0 +1,32 @@
+#ifndef COMBINATIONS_BUDGET_HPP
+#define COMBINATIONS_BUDGET_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+
+// Wall-clock deadline and number of explored assignments a single classify call may spend
+struct Budget {
+    using Clock = std::chrono::steady_clock;
+
+    Budget() = default;
+    explicit Budget(Clock::duration timeout, std::size_t max_assignments = std::numeric_limits<std::size_t>::max())
+        : deadline(Clock::now() + timeout), max_assignments(max_assignments) {}
+
+    // Accounts one assignment, the clock is read on the first one and then every clock_period assignments
+    bool spend() {
+        if (++assignments > max_assignments || (assignments % clock_period == 1 && Clock::now() > deadline)) {
+            exceeded = true;
+        }
+        return !exceeded;
+    }
+
+    static constexpr std::size_t clock_period = 1024;
+
+    Clock::time_point deadline  = Clock::time_point::max();
+    std::size_t max_assignments = std::numeric_limits<std::size_t>::max();
+    std::size_t assignments     = 0;
+    bool exceeded               = false;
+};
+
+#endif  // COMBINATIONS_BUDGET_HPP
@@ -0,0 +1,61 @@
+#ifndef COMBINATIONS_CACHE_HPP
+#define COMBINATIONS_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+// Classifications kept in a file mapped into memory, so a later run serves the inputs an earlier one classified. An
+// open-addressing table by the hash of the canonical key of the input, each slot holds the key itself so a collision is
+// never served. The file is tagged with a fingerprint of the catalogue and the tolerance and starts over empty when it
+// does not match. One process at a time has the file, it is locked while open
+class Cache {
+public:
+    static constexpr std::size_t legs          = 8;        // most components of an input kept
+    static constexpr std::size_t default_slots = 1 << 15;  // 9 MiB of file
+
+    // Type of an input no type matches
+    static constexpr std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+
+    struct Result {
+        std::uint32_t type;          // position in the catalogue or none
+        std::vector<int> positions;  // of the components in canonical order, served should the check exceed the budget
+    };
+
+    // Of a catalogue of the given number of types, nullptr if the file cannot be mapped or another process has it open
+    static std::unique_ptr<Cache> open(const std::filesystem::path& path, std::uint64_t fingerprint, std::size_t types,
+                                       std::size_t slots = default_slots);
+
+    Cache(const Cache&) = delete;
+    ~Cache();
+
+    // None for a type past those of the catalogue, which only a damaged file holds
+    std::optional<Result> find(const std::vector<std::int64_t>& key);
+    // Not kept once three quarters of the slots are taken or for more components than legs
+    void add(const std::vector<std::int64_t>& key, const Result& result);
+
+    const std::filesystem::path path;
+
+private:
+    struct Header;
+    struct Slot;
+
+    Cache(std::filesystem::path path, int fd, void* data, std::size_t size, std::size_t types);
+
+    Header& header() const;
+    // Slot of the key or the empty one it would take, nullptr if it cannot be kept
+    Slot* slot(const std::vector<std::int64_t>& key) const;
+
+    const int fd;  // holding the lock of the file
+    void* const data;
+    const std::size_t size;
+    const std::size_t types;
+    std::mutex mutex;  // of the table
+};
+
+#endif  // COMBINATIONS_CACHE_HPP
@@ -0,0 +1,61 @@
+#ifndef COMBINATIONS_CATALOGUE_HPP
+#define COMBINATIONS_CATALOGUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "combinations/Combination.hpp"
+#include "combinations/Signature.hpp"
+
+// Combination types compiled into one block of memory that refers to its parts by offsets, so processes mapping the
+// block at different addresses can share a single copy of it
+struct Catalogue {
+    enum class Kind : char { Fixed = 'i', Chain = 'c', Multiple = 'u', More = 'o' };
+
+    // One type, the legs and the name point either into the image or into the storage the image is compiled from.
+    // Everything needed to reject a type without its matcher is in the entry
+    struct Entry {
+        Kind kind;
+        std::span<const Leg> legs;
+        std::string_view name;
+        std::int64_t unit;  // ratio ticks of one step of the leg ratios
+        std::size_t min_count;
+        Signature shape{};  // of the legs, filled by read
+    };
+
+    // Read-only mapping of a shared image
+    class Mapping {
+    public:
+        Mapping(const std::byte* data, std::size_t size) : data(data), size(size) {}
+        Mapping(Mapping&& other) noexcept;
+        Mapping(const Mapping&) = delete;
+        ~Mapping();
+
+        std::span<const std::byte> image() const { return {data, size}; }
+
+    private:
+        const std::byte* data;
+        std::size_t size;
+    };
+
+    static std::vector<std::byte> compile(const std::vector<Entry>& entries);
+    // Appends the entries of the image pointing into it, false if the image was not compiled by this build
+    static bool read(std::span<const std::byte> image, std::vector<Entry>& entries);
+
+    // Whether components of the signature may form the type, exact when the type has a single signature
+    static bool admits(const Entry& entry, const Signature& signature);
+    // Signature the type is indexed under, the reduced form of every signature it admits but those of a More of options
+    static Signature key(const Entry& entry);
+
+    // POSIX shared memory segments, the name starts with a slash
+    static bool publish(const std::string& name, std::span<const std::byte> image);
+    static std::optional<Mapping> attach(const std::string& name);
+    static bool remove(const std::string& name);
+};
+
+#endif  // COMBINATIONS_CATALOGUE_HPP
@@ -1,96 +1,213 @@
 #ifndef COMBINATIONS_COMBINATION_HPP
 #define COMBINATIONS_COMBINATION_HPP
 
+#include <cstdint>
 #include <map>
-#include <variant>
+#include <memory>
+#include <span>
+#include <string_view>
 #include <vector>
 
+#include "combinations/Book.hpp"
+#include "combinations/Budget.hpp"
 #include "combinations/Component.hpp"
 #include "combinations/DateTime.hpp"
+#include "combinations/Input.hpp"
+#include "combinations/Signature.hpp"
+#include "combinations/Strategy.hpp"
 #include "pugixml.hpp"
 
+// One leg of a type packed into 16 bytes. The ratio is a number of steps of the unit of its type or, for a leg matching
+// by sign only, just the sign. The strike and the expiration are each a letter naming a value the legs with that letter
+// share, '\0' for any value, or an offset level ordering the values of a group of legs; the expiration may also be a
+// period after the base of its group
 struct Leg {
+    enum Kind : std::uint8_t { Letter, Offset, Period };
+
+    static constexpr std::uint8_t bit(InstrumentType type) { return 1 << Signature::index(type); }
+
     InstrumentType type;
-    std::variant<double, bool> ratio;
-    std::variant<char, int> strike;
-    std::variant<char, int, Period> expiration;
+    std::uint8_t mask;                 // bits of the component types fitting the leg
+    std::uint8_t sign : 1;             // only the sign of the ratio has to match
+    std::uint8_t strike_kind : 1;      // Letter or Offset
+    std::uint8_t expiration_kind : 2;  // any Kind
+    OffsetType unit;                   // of a period
+    std::int32_t ratio;
+    std::int32_t strike;
+    std::int32_t expiration;  // letter, offset level or length of the period
+
+    // Branch-free: every alternative is computed and the kind only selects one
+    bool fits(InstrumentType component) const { return (mask >> Signature::index(component)) & 1; }
+    bool fits_ratio(const Input& input, int component, std::int64_t unit) const {
+        const auto value     = input.ratios[component];
+        const auto target    = ratio * input.unit(unit);
+        const bool same_sign = input.positive[component] == (ratio > 0);
+        const bool close     = value - target <= input.ratio_epsilon && target - value <= input.ratio_epsilon;
+        return sign ? same_sign : close;
+    }
+    // Offset level of the strike or the expiration, 0 for a letter
+    int level(std::int32_t Leg::*dimension) const { return kind(dimension) == Offset ? this->*dimension : 0; }
+    Kind kind(std::int32_t Leg::*dimension) const {
+        return static_cast<Kind>(dimension == &Leg::strike ? strike_kind : expiration_kind);
+    }
+};
+
+static_assert(sizeof(Leg) == 16, "legs are packed");
+static_assert(std::is_trivially_copyable_v<Leg>, "legs are copied into catalogue images as bytes");
+
+// Resumable enumeration of the valid orders of an input
+struct Orders {
+    virtual ~Orders() = default;
+
+    virtual bool next(std::vector<int>& order) = 0;
 };
 
+// Legs and names of the types point into a catalogue image that outlives them
 struct Combination {
-    explicit Combination(std::string&& name);
+    Combination(std::string_view name, std::int64_t unit);
     virtual ~Combination() = default;
 
     bool check(const std::vector<Component>& components, std::vector<int>& order);
+    bool check(const Input& input, std::vector<int>& order, Budget& budget);
+
+    // Every valid order one at a time, the input has to outlive the result
+    std::unique_ptr<Orders> enumerate(const Input& input);
+    // Number of valid orders, saturates at the maximum of std::size_t
+    std::size_t count(const Input& input);
+
+    // Takes unused components of the book forming this type, one vector of book indices in leg order per instance
+    virtual void decompose(Book& book, std::vector<std::vector<int>>& parts) = 0;
+
+    // Engine post_check runs for the given number of components
+    virtual Strategy strategy(std::size_t size) const = 0;
 
-    const std::string name;
+    const std::string_view name;
+    const std::int64_t unit;  // ratio ticks of one step of the leg ratios
 
 protected:
-    virtual bool pre_check(const std::vector<Component>& components)                           = 0;
-    virtual bool post_check(const std::vector<Component>& components, std::vector<int>& order) = 0;
+    virtual bool pre_check(const Input& input)                                           = 0;
+    virtual bool post_check(const Input& input, std::vector<int>& order, Budget& budget) = 0;
+    virtual std::unique_ptr<Orders> orders(const Input& input)                           = 0;
+    virtual std::size_t count_orders(const Input& input);
 };
 
 // Multiple
 struct Multiple: Combination {
-    Multiple(std::vector<Leg>&& legs, std::string&& string);
+    Multiple(std::span<const Leg> legs, std::string_view name, std::int64_t unit);
+
+    Strategy strategy(std::size_t size) const override;
+
+    // Engines behind post_check, both find the lexicographically first valid order
+    bool permute(const Input& input, std::vector<int>& order, Budget& budget);
+    bool backtrack(const Input& input, std::vector<int>& order, Budget& budget);
+
+    // Greedy over the first legs in book order, then a bounded repair pass lets a new instance take one leg of an
+    // instance found before that can be formed again without it. Not a maximum matching: one leg per repair
+    void decompose(Book& book, std::vector<std::vector<int>>& parts) override;
 
 protected:
-    const std::vector<Leg> legs;
+    const std::span<const Leg> legs;
 
-    virtual bool check_amount(const std::vector<Component>& components);
-    bool pre_check(const std::vector<Component>& components) override;
-    bool post_check(const std::vector<Component>& components, std::vector<int>& order) override;
+    virtual bool check_amount(std::size_t size) const;
+    bool pre_check(const Input& input) override;
+    bool post_check(const Input& input, std::vector<int>& order, Budget& budget) override;
+    std::unique_ptr<Orders> orders(const Input& input) override;
 
-private:
-    bool check_permutation(const std::vector<Component>& components, const std::vector<int>& order);
+    bool check_permutation(const Input& input, const std::vector<int>& order);
+    bool check_block(const Input& input, const std::vector<int>& order, std::size_t begin, std::size_t end);
 
-    template <class T, class... Ts>
-    static bool offset_check(std::map<char, T>& map, std::map<int, T>& offset_map, const std::variant<Ts...>& leg,
+private:
+    struct Search;
+    struct Enumeration;
+    struct Repair;
+    bool search(const Input& input, std::vector<int>& order, Search& state, std::size_t position);
+    bool extend(Book& book, std::vector<int>& order, std::size_t position, Budget& budget, Repair* repair = nullptr);
+    void repair(Book& book, std::vector<std::vector<int>>& parts, std::size_t first);
+    bool reform(Book& book, std::vector<int>& part, int taken);
+
+    template <class T>
+    static bool offset_check(std::map<char, T>& map, std::map<int, T>& offset_map, Leg::Kind kind, std::int32_t leg,
                              const T& comb);
 };
 
 // Fixed
 struct Fixed: Multiple {
-    Fixed(std::vector<Leg>&& legs, std::string&& string);
+    Fixed(std::span<const Leg> legs, std::string_view name, std::int64_t unit);
 
 protected:
-    bool check_amount(const std::vector<Component>& components) override;
+    bool check_amount(std::size_t size) const override;
 };
 
 // More
 struct More: Combination {
-    More(Leg&& leg, std::string&& name, std::size_t min_count);
+    More(const Leg& leg, std::string_view name, std::int64_t unit, std::size_t min_count);
+
+    Strategy strategy(std::size_t size) const override;
+
+    void decompose(Book& book, std::vector<std::vector<int>>& parts) override;
 
 protected:
-    bool pre_check(const std::vector<Component>& components) override;
-    bool post_check(const std::vector<Component>& components, std::vector<int>& order) override;
+    bool pre_check(const Input& input) override;
+    bool post_check(const Input& input, std::vector<int>& order, Budget& budget) override;
+    std::unique_ptr<Orders> orders(const Input& input) override;
+    std::size_t count_orders(const Input& input) override;
 
 private:
+    struct Enumeration;
+
+    bool fits(const Input& input, int component) const;
+
     Leg leg;
     const std::size_t min_count;
 };
 
+// Chain
+struct Chain: Fixed {
+    Chain(std::span<const Leg> legs, std::string_view name, std::int64_t unit);
+
+    Strategy strategy(std::size_t size) const override;
+
+    // One strike or expiration offset chain over all legs, the other dimension is described by letters only
+    static bool eligible(std::span<const Leg> legs);
+
+protected:
+    bool post_check(const Input& input, std::vector<int>& order, Budget& budget) override;
+    std::size_t count_orders(const Input& input) override;
+
+private:
+    bool sort_runs(const Input& input, std::vector<int>& sorted);
+    bool fits(const Input& input, const std::vector<int>& sorted, std::size_t run);
+    bool assign(const Input& input, std::vector<int>& order, std::vector<int>& sorted, std::size_t run,
+                Budget& budget);
+
+    const bool by_strike;
+    bool uniform;                     // the other dimension puts the same constraint on every leg
+    std::vector<int> positions;       // leg positions sorted by offset level
+    std::vector<std::size_t> bounds;  // runs of equal level in positions
+};
+
 // ================================================== Implementation ===================================================
 
-template <class T, class... Ts>
-bool Multiple::offset_check(std::map<char, T>& map, std::map<int, T>& offset_map, const std::variant<Ts...>& leg,
+template <class T>
+bool Multiple::offset_check(std::map<char, T>& map, std::map<int, T>& offset_map, Leg::Kind kind, std::int32_t leg,
                             const T& comb) {
-    if (std::holds_alternative<char>(leg)) {
-        if (std::get<char>(leg) != '\0') {
-            if (!map.emplace(std::get<char>(leg), comb).second && map[std::get<char>(leg)] != comb) {
+    if (kind == Leg::Letter) {
+        const auto letter = static_cast<char>(leg);
+        if (letter != '\0') {
+            if (!map.emplace(letter, comb).second && map[letter] != comb) {
                 return false;
             }
         }
         offset_map.clear();
         offset_map[0] = comb;
     } else {
-        if (offset_map.emplace(std::get<int>(leg), comb).second) {
-            auto index = std::get<int>(leg);
+        if (offset_map.emplace(leg, comb).second) {
             for (const auto [q, amount] : offset_map) {
-                if ((q < index && amount >= comb) || (q > index && amount <= comb)) {
+                if ((q < leg && amount >= comb) || (q > leg && amount <= comb)) {
                     return false;
                 }
             }
-        } else if (offset_map[std::get<int>(leg)] != comb) {
+        } else if (offset_map[leg] != comb) {
             return false;
         }
     }
@@ -1,24 +1,192 @@
 #ifndef COMBINATIONS_COMBINATIONS_HPP
 #define COMBINATIONS_COMBINATIONS_HPP
 
+#include <chrono>
+#include <concepts>
+#include <cstddef>
 #include <filesystem>
+#include <optional>
+#include <span>
 #include <vector>
 
+#include "combinations/Budget.hpp"
 #include "combinations/Component.hpp"
+#include "combinations/Signature.hpp"
+#include "combinations/Strategy.hpp"
+#include "combinations/Tolerance.hpp"
 
+struct Combination;
 struct Component;
+struct Input;
+struct Orders;
+
+struct Classification {
+    enum class Status : char { Classified, Unclassified, BudgetExceeded };
+
+    Status status{Status::Unclassified};
+    std::string name;
+    std::size_t evaluated{0};  // types admitting the components fully checked before the result was known
+    double scale{1};           // of the ratios of the type the components are a multiple of, with scaled tolerance
+    bool cached{false};        // served by the cache, which checks the known type only
+};
+
+struct Match {
+    std::string name;
+    std::vector<int> order;
+};
+
+struct Shadowed {
+    std::string name;
+    std::string by;
+};
+
+struct Decomposition {
+    struct Part {
+        std::string name;
+        std::vector<int> components;  // index of the component taken by every leg, starting from 0
+    };
+
+    std::vector<Part> parts;
+    std::vector<int> leftover;
+};
 
 class Combinations {
     struct Implementation;
     const std::unique_ptr<Implementation> implementation;
 
+    bool load_buffer(std::span<const char> resource);
+    // Classify without the slow log
+    Classification match(const std::vector<Component>& components, std::vector<int>& order, Budget& budget) const;
+
 public:
+    // Yields every type the components satisfy in priority order, the components have to outlive it
+    class Matches {
+    public:
+        Matches(Matches&&) noexcept;
+        ~Matches();
+
+        std::optional<Match> next();
+
+    private:
+        friend class Combinations;
+        Matches(const Implementation& implementation, const std::vector<Component>& components);
+
+        const Implementation& implementation;
+        std::unique_ptr<Input> input;
+        std::vector<std::size_t> candidates;  // positions of the types admitting the components
+        std::size_t position{0};
+    };
+
+    // Yields every valid order of the components for one type, the components have to outlive it
+    class Orderings {
+    public:
+        Orderings(Orderings&&) noexcept;
+        ~Orderings();
+
+        std::optional<std::vector<int>> next();
+
+    private:
+        friend class Combinations;
+        Orderings(Combination* combination, const std::vector<Component>& components, const Tolerance& tolerance);
+
+        std::unique_ptr<Input> input;
+        std::unique_ptr<Orders> orders;
+    };
+
+    // Components entered one at a time, the type is looked up again only among the types their signature admits and
+    // only when asked after a change, the combinations have to outlive it
+    class ClassificationSession {
+    public:
+        ClassificationSession(ClassificationSession&&) noexcept;
+        ~ClassificationSession();
+
+        // Position of the added component
+        std::size_t add(const Component& component);
+        // False and nothing changed for a position past the components
+        bool remove(std::size_t position);
+        bool modify(std::size_t position, const Component& component);
+
+        const std::vector<Component>& components() const { return legs; }
+        // Same result as classify on the current components
+        const std::string& current(std::vector<int>& order);
+
+    private:
+        friend class Combinations;
+        explicit ClassificationSession(const Implementation& implementation);
+
+        const Implementation& implementation;
+        std::vector<Component> legs;
+        Signature signature;
+        std::vector<std::size_t> candidates;  // types admitting the signature
+        bool reshaped{true};                  // signature changed since candidates were found
+        bool changed{true};                   // components changed since the last classification
+        std::string name;
+        std::vector<int> positions;
+    };
+
     Combinations();
     ~Combinations();
 
+    // Precision of the ratios and strikes of the components compared from then on
+    void set_tolerance(const Tolerance& tolerance);
+    // Off by default. Classify checks the types it returns most often first where no result can change, the order is
+    // kept up to date as it runs. Not to be called while classifying
+    void set_adaptive(bool adaptive);
+    // Off by default. Classify keeps the inputs it found unclassified in bounded memory and returns at once for the
+    // same components in any order. Not to be called while classifying
+    void set_unclassified_filter(bool filter);
+    // Classify keeps its results in the file, created if missing, and serves the same components in any order from it
+    // in this and later runs, with the order it returns without the file. The file is emptied when the loaded types or
+    // the tolerance differ from those it was written with. False if it cannot be mapped or another process or
+    // Combinations has it open
+    bool open_cache(const std::filesystem::path& path);
+    // Classify calls taking longer than the threshold are appended to the file with their components, result and time,
+    // the calls do not wait for the file. False if it cannot be opened
+    bool open_slow_log(const std::filesystem::path& path, std::chrono::nanoseconds threshold);
+    // Records of slow calls lost as the log fell behind
+    std::size_t slow_log_dropped() const;
+
     bool load(const std::filesystem::path& resource);
+    // Resource held in memory, a template so that {} and strings still convert to a path only
+    template <std::same_as<std::span<const char>> Buffer>
+    bool load(Buffer resource) {
+        return load_buffer(resource);
+    }
+    // Adds the types of a compiled catalogue image, they are used in place and the image has to outlive them
+    bool load_image(std::span<const std::byte> image);
+    // Adds the types of etc/combinations.xml compiled into the library, false if the library was built without it
+    bool load_builtin();
+
+    // Compiled image of the loaded types
+    std::vector<std::byte> image() const;
+
+    // Publishes the loaded types as a POSIX shared memory segment, the name starts with a slash
+    bool share(const std::string& name) const;
+    // Adds the types of a shared segment, they are used in place and not copied
+    bool attach(const std::string& name);
 
     std::string classify(const std::vector<Component>& components, std::vector<int>& order) const;
+    Classification classify(const std::vector<Component>& components, std::vector<int>& order, Budget& budget) const;
+
+    ClassificationSession session() const;
+
+    Matches matches(const std::vector<Component>& components) const;
+    std::vector<Match> classify_all(const std::vector<Component>& components) const;
+
+    Orderings orderings(const std::string& name, const std::vector<Component>& components) const;
+    // Number of valid orders for the named type, counted without enumeration where the type allows it
+    std::size_t count_orderings(const std::string& name, const std::vector<Component>& components) const;
+
+    // Splits any number of components into combinations, types earlier in the catalogue take their legs first
+    Decomposition decompose(const std::vector<Component>& components) const;
+
+    // Matching engine the named type uses for the given number of components
+    std::optional<Strategy> strategy(const std::string& name, std::size_t size) const;
+
+    // Types classify never returns, an earlier type matches whatever they match
+    std::vector<Shadowed> shadowed() const;
+    // No components match both named types
+    bool exclusive(const std::string& a, const std::string& b) const;
 };
 
 #endif  // COMBINATIONS_COMBINATIONS_HPP
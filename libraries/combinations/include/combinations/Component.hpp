@@ -14,7 +14,7 @@ struct Component {
     InstrumentType type{InstrumentType::Unknown};
     double ratio{0};
     double strike{0};
-    std::tm expiration;
+    std::tm expiration{};
 };
 
 #endif  // COMBINATIONS_COMPONENT_HPP
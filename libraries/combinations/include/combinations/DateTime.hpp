@@ -16,6 +16,8 @@ struct Expiration {
     Expiration() = default;
     explicit Expiration(const std::tm& tm);
     bool check_expiration(const Period& period, const Expiration& expiration);
+    // Year, month and day in one number, ordered as the dates are
+    int number() const { return (year * 16 + month) * 32 + day; }
 
     // Сравнение на равенство: ==, !=
     friend bool operator==(const Expiration& day1, const Expiration& day2);
@@ -0,0 +1,56 @@
+#ifndef COMBINATIONS_INPUT_HPP
+#define COMBINATIONS_INPUT_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "combinations/Component.hpp"
+#include "combinations/DateTime.hpp"
+#include "combinations/Signature.hpp"
+#include "combinations/Tolerance.hpp"
+
+// Components of a classify call with the work shared by all combination types done once
+struct Input {
+    explicit Input(const std::vector<Component>& components, const Tolerance& tolerance = {});
+
+    std::size_t size() const { return components.size(); }
+    bool contains(InstrumentType type) const { return !of_type(type).empty(); }
+
+    // Indices of the components of the given type in increasing order
+    const std::vector<int>& of_type(InstrumentType type) const;
+
+    // Indices of the components sorted by type, ratio, sign, strike and expiration, equal components in any order
+    std::vector<int> canonical() const;
+    // The scale, then the type with the sign of the ratio, the ratio, strike and expiration of the components in the
+    // canonical order: all a classification depends on, the same for any order of the components
+    std::vector<std::int64_t> key(const std::vector<int>& canonical) const;
+    static std::uint64_t hash(const std::vector<std::int64_t>& key);
+
+    // Ticks of one step of the leg ratios of a type with the given one, a scaled input has its own
+    std::int64_t unit(std::int64_t type) const { return scaled ? 1 : type; }
+
+    const std::vector<Component>& components;
+    const bool scaled;
+    std::int64_t scale = 1;  // ticks divided out of the ratios of a scaled input, their greatest common divisor
+    std::vector<Expiration> expirations;
+    std::vector<std::int64_t> ratios;    // in ticks of the tolerance or, scaled, in steps of the scale
+    std::vector<std::uint8_t> positive;  // ratio above 0 as given, a tiny one rounds to 0 ticks
+    std::vector<std::int64_t> strikes;   // in ticks of the tolerance
+    std::int64_t ratio_epsilon;
+    std::vector<int> twins;  // previous equal component or -1
+
+    // Of all the components, what the profiles of the types are checked against
+    std::array<int, Signature::types> counts{};         // components by type
+    std::array<int, Signature::types> positives{};      // components with a positive ratio by type
+    std::array<std::int64_t, Signature::types> sums{};  // of the ratios by type, saturating
+    int strike_values, expiration_values;               // distinct
+
+private:
+    // Order of the canonical key
+    bool less(int a, int b) const;
+
+    std::array<std::vector<int>, Signature::types> types;
+};
+
+#endif  // COMBINATIONS_INPUT_HPP
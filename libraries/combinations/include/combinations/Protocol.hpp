@@ -0,0 +1,67 @@
+#ifndef COMBINATIONS_PROTOCOL_HPP
+#define COMBINATIONS_PROTOCOL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "combinations/Combinations.hpp"
+#include "combinations/Component.hpp"
+
+// Binary messages of the classification server and of the logs, every message is sent or written as a frame: its
+// length in four bytes and the message itself, integers are little-endian
+struct Frame {
+    static constexpr std::size_t header   = 4;
+    static constexpr std::size_t max_size = 1 << 20;
+
+    // Length of the frame at the start of the data, header included, nullopt while the header is incomplete
+    static std::optional<std::size_t> length(std::string_view data);
+    // Messages of the consecutive frames of a log, up to the first incomplete one
+    static std::vector<std::string_view> messages(std::string_view data);
+};
+
+struct Request {
+    std::uint64_t id{0};
+    std::vector<Component> components;
+
+    // Appends the frame of the request, false and nothing appended when a count does not fit its field
+    bool encode(std::string& out) const;
+    static std::optional<Request> decode(std::string_view message);
+};
+
+struct Response {
+    std::uint64_t id{0};
+    std::string name;
+    std::vector<int> order;
+    Classification::Status status{Classification::Status::Classified};
+
+    // Appends the frame of the response, false and nothing appended when a count does not fit its field
+    bool encode(std::string& out) const;
+    static std::optional<Response> decode(std::string_view message);
+};
+
+// Record of the slow log, a classify call that took longer than its threshold
+struct Slow {
+    std::vector<Component> components;
+    std::string name;
+    std::uint64_t nanoseconds{0};
+
+    // Appends the frame of the record, false and nothing appended when a count does not fit its field
+    bool encode(std::string& out) const;
+    static std::optional<Slow> decode(std::string_view message);
+};
+
+// Record of a capture of traffic, an input with the time it arrived since the capture started
+struct Captured {
+    std::uint64_t microseconds{0};
+    std::vector<Component> components;
+
+    // Appends the frame of the record, false and nothing appended when a count does not fit its field
+    bool encode(std::string& out) const;
+    static std::optional<Captured> decode(std::string_view message);
+};
+
+#endif  // COMBINATIONS_PROTOCOL_HPP
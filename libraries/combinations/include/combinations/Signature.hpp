@@ -0,0 +1,47 @@
+#ifndef COMBINATIONS_SIGNATURE_HPP
+#define COMBINATIONS_SIGNATURE_HPP
+
+#include <array>
+#include <compare>
+#include <cstddef>
+
+#include "combinations/Component.hpp"
+
+// Number of components of every instrument type, necessary for a match and cheap to keep up to date
+struct Signature {
+    static constexpr std::size_t types = 6;
+    static constexpr std::size_t index(InstrumentType type) {
+        switch (type) {
+        case InstrumentType::C:
+            return 0;
+        case InstrumentType::F:
+            return 1;
+        case InstrumentType::O:
+            return 2;
+        case InstrumentType::P:
+            return 3;
+        case InstrumentType::U:
+            return 4;
+        default:
+            return 5;
+        }
+    }
+
+    void add(InstrumentType type);
+    void remove(InstrumentType type);
+
+    std::size_t count(InstrumentType type) const { return counts[index(type)]; }
+    std::size_t size() const { return total; }
+
+    Signature times(std::size_t factor) const;
+    // Divided by the greatest common divisor of the counts, the same for every multiple of a signature
+    Signature reduced() const;
+
+    auto operator<=>(const Signature&) const = default;
+
+private:
+    std::array<std::size_t, types> counts{};
+    std::size_t total{0};
+};
+
+#endif  // COMBINATIONS_SIGNATURE_HPP
@@ -0,0 +1,50 @@
+#ifndef COMBINATIONS_SLOWLOG_HPP
+#define COMBINATIONS_SLOWLOG_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "combinations/Component.hpp"
+
+// Classify calls slower than a threshold appended to a file as Slow frames of the protocol. A call only encodes its
+// record and queues it, a thread of the log writes the file. Records beyond a full queue or too large for a frame are
+// dropped and counted
+class SlowLog {
+public:
+    static constexpr std::size_t max_queued = 1024;
+
+    // Nullptr if the file cannot be opened for appending
+    static std::unique_ptr<SlowLog> open(const std::filesystem::path& path, std::chrono::nanoseconds threshold);
+
+    SlowLog(const SlowLog&) = delete;
+    // Writes the queued records
+    ~SlowLog();
+
+    void add(const std::vector<Component>& components, const std::string& name, std::chrono::nanoseconds elapsed);
+    std::size_t dropped() const;
+
+    const std::chrono::nanoseconds threshold;
+
+private:
+    SlowLog(std::ofstream file, std::chrono::nanoseconds threshold);
+
+    void write();
+
+    std::ofstream file;
+    mutable std::mutex mutex;  // of the queue and the flags
+    std::condition_variable queued;
+    std::vector<std::string> records;
+    std::size_t lost{0};
+    bool closing{false};
+    std::thread writer;
+};
+
+#endif  // COMBINATIONS_SLOWLOG_HPP
@@ -0,0 +1,23 @@
+#ifndef COMBINATIONS_STRATEGY_HPP
+#define COMBINATIONS_STRATEGY_HPP
+
+#include <string_view>
+
+// Matching engine used by a combination type for a given number of components
+enum class Strategy : char { Permutation = 'p', Backtracking = 'b', Chain = 'c', Linear = 'l' };
+
+constexpr std::string_view to_string(Strategy strategy) {
+    switch (strategy) {
+    case Strategy::Permutation:
+        return "permutation";
+    case Strategy::Backtracking:
+        return "backtracking";
+    case Strategy::Chain:
+        return "chain";
+    case Strategy::Linear:
+        return "linear";
+    }
+    return {};
+}
+
+#endif  // COMBINATIONS_STRATEGY_HPP
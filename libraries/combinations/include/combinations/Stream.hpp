@@ -0,0 +1,72 @@
+#ifndef COMBINATIONS_STREAM_HPP
+#define COMBINATIONS_STREAM_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "combinations/Combinations.hpp"
+#include "combinations/Component.hpp"
+
+// Legs arriving one at a time tagged with the id of their order, an order is classified once all its legs arrived or
+// it expired, results come out in the order the first legs arrived
+class Stream {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Result {
+        enum class Status : char { Complete, Timeout, Evicted };
+
+        std::uint64_t id{0};
+        Status status{Status::Complete};
+        std::vector<Component> components;
+        std::string name;
+        std::vector<int> order;
+    };
+
+    static constexpr std::size_t default_backlog = 1 << 16;
+
+    // Orders older than the timeout expire, the oldest open order is evicted when more than capacity are open. At most
+    // backlog orders, open or waiting for next, are kept: past that the oldest is dropped, evicted first if open
+    Stream(const Combinations& combinations, Clock::duration timeout, std::size_t capacity,
+           std::size_t backlog = default_backlog);
+
+    void push(std::uint64_t id, std::size_t expected, const Component& component, Clock::time_point time);
+    // Classifies the orders whose first leg arrived a timeout before the given time
+    void expire(Clock::time_point time);
+    // Classifies every open order
+    void flush();
+
+    std::optional<Result> next();
+
+    std::size_t open() const { return groups.size(); }
+    // Results dropped because next was not called often enough
+    std::size_t dropped() const { return lost; }
+
+private:
+    struct Group {
+        std::size_t expected{0};
+        Clock::time_point time;
+        bool closed{false};
+        Result result;
+    };
+
+    void close(Group& group, Result::Status status);
+    void evict();
+
+    const Combinations& combinations;
+    const Clock::duration timeout;
+    const std::size_t capacity;
+    const std::size_t backlog;
+
+    std::unordered_map<std::uint64_t, std::size_t> groups;  // open orders by id, sequence number of the first leg
+    std::deque<Group> queue;                                 // all orders not emitted yet in arrival order
+    std::size_t first{0};                                    // sequence number of the queue front
+    std::size_t oldest{0};                                   // no open order arrived before this sequence number
+    std::size_t lost{0};
+};
+
+#endif  // COMBINATIONS_STREAM_HPP
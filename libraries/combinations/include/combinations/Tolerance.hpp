@@ -0,0 +1,52 @@
+#ifndef COMBINATIONS_TOLERANCE_HPP
+#define COMBINATIONS_TOLERANCE_HPP
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+// Precision of comparing ratios and strikes. Both are quantised to integer ticks once per input, so matching compares
+// integers only: ratios in millionths and strikes in ticks of the given size
+struct Tolerance {
+    static constexpr double ratio_ticks = 1e6;  // per unit of a ratio
+    // Larger ratios saturate: they keep their sign, no leg ratio reaches them and sums of many stay in range
+    static constexpr std::int64_t max_ratio = std::int64_t{1} << 53;
+    // Larger strikes are more than a tick apart from any other double, see strike_of
+    static constexpr std::int64_t max_strike = std::int64_t{1} << 62;
+
+    double ratio  = 0;     // largest difference of ratios still equal, on top of their rounding to ticks
+    double strike = 1e-6;  // size of a strike tick, strikes rounding to the same tick are equal
+    // Ratios of the whole input match the legs up to a common positive factor, 2/-4/2 is then a butterfly. The ratio
+    // difference does not apply, the ratios are compared once divided by their greatest common divisor
+    bool scaled = false;
+
+    // NaN is 0, the ratio of no leg
+    static std::int64_t ratio_of(double ratio) {
+        const auto ticks = ratio * ratio_ticks;
+        if (std::isnan(ticks)) {
+            return 0;
+        }
+        if (std::abs(ticks) >= static_cast<double>(max_ratio)) {
+            return ticks < 0 ? -max_ratio : max_ratio;
+        }
+        return std::llround(ticks);
+    }
+    // Past max_strike ticks the bits of the doubles counted from max_strike take over: they are as ordered as the
+    // doubles and fit with infinity below the largest integer, which stands for NaN
+    std::int64_t strike_of(double strike) const {
+        const auto ticks = strike / this->strike;
+        if (std::isnan(ticks)) {
+            return std::numeric_limits<std::int64_t>::max();
+        }
+        if (std::abs(ticks) < static_cast<double>(max_strike)) {
+            return std::llround(ticks);
+        }
+        const auto beyond = max_strike + (std::bit_cast<std::int64_t>(std::abs(ticks)) -
+                                          std::bit_cast<std::int64_t>(static_cast<double>(max_strike)));
+        return ticks < 0 ? -beyond : beyond;
+    }
+    std::int64_t ratio_epsilon() const { return ratio_of(ratio); }
+};
+
+#endif  // COMBINATIONS_TOLERANCE_HPP
@@ -0,0 +1,34 @@
+#ifndef COMBINATIONS_UNCLASSIFIABLE_HPP
+#define COMBINATIONS_UNCLASSIFIABLE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+// Inputs no type matched, by their canonical key. A Bloom filter in front answers most inputs never seen without a
+// lock, a hit is confirmed by the exact key so a false positive only costs a lookup. Both are cleared when the keys
+// reach the capacity
+class Unclassifiable {
+public:
+    using Key = std::vector<std::int64_t>;
+
+    static constexpr std::size_t bits     = 1 << 16;  // of the filter, 8 KiB
+    static constexpr std::size_t hashes   = 4;        // bits set per key
+    static constexpr std::size_t capacity = 4096;     // keys kept until the reset, about a tenth of the bits
+
+    Unclassifiable();
+
+    bool contains(const Key& key) const;
+    void add(Key key);
+
+private:
+    const std::unique_ptr<std::atomic<std::uint64_t>[]> filter;
+    mutable std::mutex mutex;  // of the keys and of clearing the filter
+    std::set<Key> keys;
+};
+
+#endif  // COMBINATIONS_UNCLASSIFIABLE_HPP
@@ -0,0 +1,97 @@
+#include "combinations/Adaptive.hpp"
+
+#include <queue>
+#include <utility>
+
+Adaptive::Adaptive(const std::vector<Catalogue::Entry>& entries, const Analysis& analysis)
+    : entries(entries), analysis(analysis), hits(new std::atomic<std::uint64_t>[entries.size()]()) {}
+
+std::shared_ptr<const std::vector<std::size_t>> Adaptive::find(const Signature& signature) const {
+    std::lock_guard lock(mutex);
+    const auto found = walks.find(signature);
+    return found != walks.end() ? found->second.order : nullptr;
+}
+
+std::shared_ptr<const std::vector<std::size_t>> Adaptive::add(const Signature& signature,
+                                                              const std::vector<std::size_t>& candidates) {
+    Walk walk;
+    for (const auto i : candidates) {
+        if (analysis.shadowed[i] == Analysis::none) {
+            walk.types.push_back(i);
+        }
+    }
+    const auto size = walk.types.size();
+    walk.later.resize(size);
+    walk.earlier.resize(size);
+    for (std::size_t b = 0; b < size; ++b) {
+        for (std::size_t a = 0; a < b; ++a) {
+            if (!analysis.exclusive(entries, walk.types[a], walk.types[b])) {
+                walk.later[a].push_back(b);
+                ++walk.earlier[b];
+            }
+        }
+    }
+    walk.order = order(walk);
+
+    std::lock_guard lock(mutex);
+    return walks.try_emplace(signature, std::move(walk)).first->second.order;
+}
+
+void Adaptive::count(std::size_t type) {
+    if (type != Analysis::none) {
+        hits[type].fetch_add(1, std::memory_order_relaxed);
+    }
+    if (classifications.fetch_add(1, std::memory_order_relaxed) % period == period - 1) {
+        // A reorder still running is as good as this one
+        if (std::unique_lock lock(reordering, std::try_to_lock); lock) {
+            reorder();
+        }
+    }
+}
+
+// Walks are never removed and only their orders change, so they are ordered outside the lock and swapped in. A walk
+// added meanwhile has just been ordered
+void Adaptive::reorder() {
+    std::vector<Walk*> current;
+    {
+        std::lock_guard lock(mutex);
+        current.reserve(walks.size());
+        for (auto& [signature, walk] : walks) {
+            current.push_back(&walk);
+        }
+    }
+    for (auto* walk : current) {
+        auto order = this->order(*walk);
+        std::lock_guard lock(mutex);
+        walk->order.swap(order);
+    }
+}
+
+// Takes the most hit of the types every type they stay after has been taken before, the earliest of equally hit ones
+std::shared_ptr<const std::vector<std::size_t>> Adaptive::order(const Walk& walk) const {
+    const auto size = walk.types.size();
+    auto earlier    = walk.earlier;
+    // Hits and position of the types that may be taken, the most hit and then the earliest on top
+    std::priority_queue<std::pair<std::uint64_t, std::size_t>> ready;
+    const auto push = [&](std::size_t j) {
+        ready.emplace(hits[walk.types[j]].load(std::memory_order_relaxed), size - 1 - j);
+    };
+    for (std::size_t j = 0; j < size; ++j) {
+        if (earlier[j] == 0) {
+            push(j);
+        }
+    }
+    auto order = std::make_shared<std::vector<std::size_t>>();
+    order->reserve(size);
+    while (!ready.empty()) {
+        const auto best = size - 1 - ready.top().second;
+        ready.pop();
+        order->push_back(walk.types[best]);
+        for (const auto j : walk.later[best]) {
+            if (--earlier[j] == 0) {
+                push(j);
+            }
+        }
+    }
+    return order;
+}
@@ -0,0 +1,279 @@
+#include "combinations/Analysis.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <optional>
+#include <set>
+#include <span>
+#include <utility>
+
+namespace {
+
+using Dimension = std::int32_t Leg::*;
+
+// Component types fitting a leg of the entry, a More of options takes puts and calls too
+std::uint8_t mask(const Catalogue::Entry& entry, const Leg& leg) {
+    if (entry.kind == Catalogue::Kind::More && leg.type == InstrumentType::O) {
+        return leg.mask | Leg::bit(InstrumentType::P) | Leg::bit(InstrumentType::C);
+    }
+    return leg.mask;
+}
+
+// Smallest number of components the entry matches
+std::size_t minimum(const Catalogue::Entry& entry) {
+    return entry.kind == Catalogue::Kind::More ? entry.min_count : entry.legs.size();
+}
+
+// Bounds of the number of distinct values of a dimension over the legs of one block. Legs sharing a letter share the
+// value and so do offsets of the same level in one group, a group starting at every letter leg as its level 0. Levels
+// of one group are strictly ordered, so they are distinct
+Profile::Range range(std::span<const Leg> legs, Dimension dimension) {
+    std::set<char> letters;
+    std::set<std::pair<int, int>> offsets;  // group and level
+    std::set<int> levels;                   // of the current group
+    int any    = 0, periods = 0, group = 0, lower = 1;
+    bool based = false;
+    for (const auto& leg : legs) {
+        const auto value = leg.*dimension;
+        switch (leg.kind(dimension)) {
+        case Leg::Letter:
+            if (value == '\0') {
+                ++any;
+            } else {
+                letters.insert(static_cast<char>(value));
+            }
+            ++group;
+            based  = true;
+            levels = {0};
+            break;
+        case Leg::Offset:
+            if (!based || value != 0) {
+                offsets.emplace(group, value);
+            }
+            levels.insert(value);
+            break;
+        case Leg::Period:
+            ++periods;
+            break;
+        }
+        lower = std::max(lower, static_cast<int>(levels.size()));
+    }
+    return {lower, static_cast<int>(letters.size() + offsets.size()) + any + periods};
+}
+
+bool disjoint(const std::optional<Profile::Range>& a, const std::optional<Profile::Range>& b) {
+    return a && b && (a->max < b->min || b->max < a->min);
+}
+
+// Some signature is admitted by both entries
+bool overlap(const Catalogue::Entry& a, const Catalogue::Entry& b) {
+    using Kind = Catalogue::Kind;
+    if (a.kind == Kind::Fixed || a.kind == Kind::Chain) {
+        return Catalogue::admits(b, a.shape);
+    }
+    if (b.kind == Kind::Fixed || b.kind == Kind::Chain) {
+        return Catalogue::admits(a, b.shape);
+    }
+    if (a.kind == Kind::Multiple && b.kind == Kind::Multiple) {
+        return a.shape.reduced() == b.shape.reduced();
+    }
+    if (a.kind == Kind::More && b.kind == Kind::More) {
+        return (mask(a, a.legs.front()) & mask(b, b.legs.front())) != 0;
+    }
+    const auto& multiple = a.kind == Kind::Multiple ? a : b;
+    const auto& more     = a.kind == Kind::More ? a : b;
+    const auto blocks    = std::max<std::size_t>(1, (more.min_count + multiple.legs.size() - 1) / multiple.legs.size());
+    return Catalogue::admits(more, multiple.shape.times(blocks));
+}
+
+// A leg at least as permissive as another in a dimension, letters of a are mapped to those of b consistently
+bool permits(const Leg& a, const Leg& b, Dimension dimension, std::map<char, char>& letters) {
+    if (a.kind(dimension) != b.kind(dimension)) {
+        return false;
+    }
+    switch (a.kind(dimension)) {
+    case Leg::Letter: {
+        if (a.*dimension == '\0') {
+            return true;
+        }
+        if (b.*dimension == '\0') {
+            return false;
+        }
+        const auto [found, added] = letters.emplace(static_cast<char>(a.*dimension), static_cast<char>(b.*dimension));
+        return added || found->second == b.*dimension;
+    }
+    case Leg::Offset:
+        return a.*dimension == b.*dimension;
+    case Leg::Period:
+        return a.*dimension == b.*dimension && a.unit == b.unit;
+    }
+    return false;
+}
+
+// a * b - c, none if it overflows or a is a saturated sum: the profile then has nothing to say
+std::optional<std::int64_t> excess(std::int64_t a, std::int64_t b, std::int64_t c) {
+    std::int64_t product, result;
+    if (a == std::numeric_limits<std::int64_t>::max() || a == std::numeric_limits<std::int64_t>::min() ||
+        __builtin_mul_overflow(a, b, &product) || __builtin_sub_overflow(product, c, &result)) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+}  // anonymous namespace
+
+// Profile
+Profile Profile::of(const Catalogue::Entry& entry) {
+    Profile result;
+    result.unit = entry.unit;
+    result.smallest.fill(std::numeric_limits<std::int64_t>::max());
+    const auto add = [&result](const Leg& leg, std::size_t type) {
+        ++result.legs[type];
+        result.positives[type] += leg.ratio > 0;
+        if (!leg.sign) {
+            ++result.values[type];
+            result.sums[type] += leg.ratio;
+            result.smallest[type] = std::min<std::int64_t>(result.smallest[type], std::abs(leg.ratio));
+        }
+    };
+
+    if (entry.kind == Catalogue::Kind::More) {
+        const auto& leg = entry.legs.front();
+        for (std::size_t type = 0; type < Signature::types; ++type) {
+            if ((mask(entry, leg) >> type) & 1) {
+                add(leg, type);
+            }
+        }
+        return result;
+    }
+    for (const auto& leg : entry.legs) {
+        add(leg, Signature::index(leg.type));
+    }
+    if (entry.kind != Catalogue::Kind::Multiple) {
+        result.strikes     = range(entry.legs, &Leg::strike);
+        result.expirations = range(entry.legs, &Leg::expiration);
+    }
+    return result;
+}
+
+bool Profile::decisive(std::size_t type, std::int64_t epsilon, std::int64_t unit) const {
+    return values[type] == 0 || epsilon < smallest[type] * unit;
+}
+
+bool Profile::admits(const Input& input) const {
+    const auto unit = input.unit(this->unit);
+    for (std::size_t type = 0; type < Signature::types; ++type) {
+        if (legs[type] == 0) {
+            continue;
+        }
+        const std::int64_t count = input.counts[type];
+        if (decisive(type, input.ratio_epsilon, unit) &&
+            input.positives[type] * legs[type] != count * positives[type]) {
+            return false;
+        }
+        if (values[type] == legs[type]) {
+            // Every ratio within the epsilon of its leg, the sum within the sum of the epsilons. Sums of very many or
+            // very large ratios may not fit, those are left to the matchers
+            const auto difference = excess(input.sums[type], legs[type], count * sums[type] * unit);
+            const auto epsilon    = excess(count * legs[type], input.ratio_epsilon, 0);
+            if (difference && epsilon && (*difference > *epsilon || *difference < -*epsilon)) {
+                return false;
+            }
+        }
+    }
+    return !(strikes && (input.strike_values < strikes->min || input.strike_values > strikes->max)) &&
+           !(expirations &&
+             (input.expiration_values < expirations->min || input.expiration_values > expirations->max));
+}
+
+bool Profile::excludes(const Profile& other, const Tolerance& tolerance) const {
+    // A type with legs of a component type takes components of it from any input, a More of options takes components
+    // of at least one of the types it shares with the other type and asks the same of each
+    const auto epsilon = tolerance.scaled ? 0 : tolerance.ratio_epsilon();
+    const auto a_unit  = tolerance.scaled ? 1 : unit;
+    const auto b_unit  = tolerance.scaled ? 1 : other.unit;
+    for (std::size_t type = 0; type < Signature::types; ++type) {
+        if (legs[type] == 0 || other.legs[type] == 0) {
+            continue;
+        }
+        if (decisive(type, epsilon, a_unit) && other.decisive(type, epsilon, b_unit) &&
+            positives[type] * other.legs[type] != other.positives[type] * legs[type]) {
+            return true;
+        }
+        if (epsilon == 0 && values[type] == legs[type] && other.values[type] == other.legs[type] &&
+            sums[type] * a_unit * other.legs[type] != other.sums[type] * b_unit * legs[type]) {
+            return true;
+        }
+    }
+    return disjoint(strikes, other.strikes) || disjoint(expirations, other.expirations);
+}
+
+// Analysis
+Analysis::Analysis(const std::vector<Catalogue::Entry>& entries, const Tolerance& tolerance)
+    : shadowed(entries.size(), none), tolerance(tolerance) {
+    // Only types not shadowed themselves are tried, by the shape a type of legs has to share
+    std::map<Signature, std::vector<std::size_t>> blocks;
+    std::vector<std::size_t> mores;
+    profiles.reserve(entries.size());
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        const auto& entry = entries[i];
+        profiles.push_back(Profile::of(entry));
+
+        auto& earlier    = blocks[entry.shape];
+        const auto found = [&](const std::vector<std::size_t>& types) {
+            const auto type = std::find_if(types.begin(), types.end(),
+                                           [&](std::size_t j) { return covers(entries[j], entry); });
+            return type != types.end() ? *type : none;
+        };
+        shadowed[i] = found(mores);
+        if (shadowed[i] == none && entry.kind != Catalogue::Kind::More) {
+            shadowed[i] = found(earlier);
+        }
+        if (shadowed[i] == none) {
+            (entry.kind == Catalogue::Kind::More ? mores : earlier).push_back(i);
+        }
+    }
+}
+
+bool Analysis::exclusive(const std::vector<Catalogue::Entry>& entries, std::size_t a, std::size_t b) const {
+    return !overlap(entries[a], entries[b]) || profiles[a].excludes(profiles[b], tolerance);
+}
+
+bool Analysis::covers(const Catalogue::Entry& a, const Catalogue::Entry& b) const {
+    using Kind = Catalogue::Kind;
+    if (a.kind == Kind::More) {
+        const auto& leg = a.legs.front();
+        return minimum(b) >= a.min_count && std::all_of(b.legs.begin(), b.legs.end(), [&](const Leg& other) {
+                   return (mask(b, other) & ~mask(a, leg)) == 0 && covers(leg, a.unit, other, b.unit);
+               });
+    }
+    // A Multiple takes one block of legs as a type of fixed legs does
+    if (b.kind == Kind::More || (a.kind != Kind::Multiple && b.kind == Kind::Multiple) ||
+        a.legs.size() != b.legs.size()) {
+        return false;
+    }
+    std::map<char, char> strikes, expirations;
+    for (std::size_t j = 0; j < a.legs.size(); ++j) {
+        const auto& leg   = a.legs[j];
+        const auto& other = b.legs[j];
+        if ((other.mask & ~leg.mask) != 0 || !covers(leg, a.unit, other, b.unit) ||
+            !permits(leg, other, &Leg::strike, strikes) || !permits(leg, other, &Leg::expiration, expirations)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Analysis::covers(const Leg& a, std::int64_t a_unit, const Leg& b, std::int64_t b_unit) const {
+    const auto epsilon = tolerance.scaled ? 0 : tolerance.ratio_epsilon();
+    if (tolerance.scaled) {
+        a_unit = b_unit = 1;
+    }
+    if (a.sign) {
+        // A ratio of b within the epsilon of its value has its sign
+        return (a.ratio > 0) == (b.ratio > 0) && (b.sign || epsilon < std::abs(b.ratio) * b_unit);
+    }
+    return !b.sign && a.ratio * a_unit == b.ratio * b_unit;
+}
@@ -0,0 +1,55 @@
+#include "combinations/Book.hpp"
+
+#include <algorithm>
+
+namespace {
+
+using Iterator = std::vector<int>::const_iterator;
+
+template <class T, class Key>
+void narrow(Iterator& begin, Iterator& end, const Book::Bounds<T>& bounds, Key key) {
+    const auto below = [&key](int i, const T& value) { return key(i) < value; };
+    const auto above = [&key](const T& value, int i) { return value < key(i); };
+    if (bounds.exact) {
+        begin = std::lower_bound(begin, end, *bounds.exact, below);
+        end   = std::upper_bound(begin, end, *bounds.exact, above);
+        return;
+    }
+    if (bounds.low) {
+        begin = std::upper_bound(begin, end, *bounds.low, above);
+    }
+    if (bounds.high) {
+        end = std::lower_bound(begin, end, *bounds.high, below);
+    }
+}
+
+}  // anonymous namespace
+
+Book::Book(const std::vector<Component>& components, const Tolerance& tolerance)
+    : input(components, tolerance), used(components.size()) {
+    for (const auto type : {InstrumentType::C, InstrumentType::F, InstrumentType::O, InstrumentType::P,
+                            InstrumentType::U}) {
+        auto& sorted = index[type];
+        sorted       = input.of_type(type);
+        std::stable_sort(sorted.begin(), sorted.end(), [this](int a, int b) {
+            if (input.expirations[a] != input.expirations[b]) {
+                return input.expirations[a] < input.expirations[b];
+            }
+            return input.strikes[a] < input.strikes[b];
+        });
+    }
+}
+
+std::span<const int> Book::find(InstrumentType type, const Bounds<Expiration>& expiration,
+                                const Bounds<std::int64_t>& strike) const {
+    const auto found = index.find(type);
+    if (found == index.end()) {
+        return {};
+    }
+    auto begin = found->second.begin(), end = found->second.end();
+    narrow(begin, end, expiration, [this](int i) { return input.expirations[i]; });
+    if (expiration.exact) {
+        narrow(begin, end, strike, [this](int i) { return input.strikes[i]; });
+    }
+    return {begin, end};
+}
@@ -0,0 +1,23 @@
+#include <cstddef>
+#include <span>
+
+#include "combinations/Combinations.hpp"
+
+namespace {
+
+#ifdef COMBINATIONS_BUILTIN
+// etc/combinations.xml compiled by tools/embed.cpp at build time
+alignas(std::max_align_t) constexpr unsigned char builtin[] = {
+#include "builtin.inc"
+};
+#endif
+
+}  // anonymous namespace
+
+bool Combinations::load_builtin() {
+#ifdef COMBINATIONS_BUILTIN
+    return load_image(std::as_bytes(std::span(builtin)));
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,131 @@
+#include "combinations/Cache.hpp"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "combinations/Input.hpp"
+
+namespace {
+
+constexpr char magic[8]         = {'C', 'O', 'M', 'B', 'C', 'A', 'C', 'H'};
+constexpr std::uint32_t version = 2;                    // keys with the signs of the ratios
+constexpr std::size_t key_size  = 1 + 4 * Cache::legs;  // the scale and four values of every component
+
+}  // anonymous namespace
+
+struct Cache::Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t legs;
+    std::uint64_t fingerprint;
+    std::uint64_t slots;
+    std::uint64_t used;
+};
+
+struct Cache::Slot {
+    std::uint64_t hash;
+    std::uint32_t type;
+    std::uint32_t size;  // of the key, 0 for an empty slot
+    std::int64_t key[key_size];
+    std::uint8_t positions[legs];
+};
+
+std::unique_ptr<Cache> Cache::open(const std::filesystem::path& path, std::uint64_t fingerprint, std::size_t types,
+                                   std::size_t slots) {
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return nullptr;
+    }
+    // Before the file is checked or emptied: another process may have it mapped, the mutex only orders this one
+    if (flock(fd, LOCK_EX | LOCK_NB) != 0) {
+        close(fd);
+        return nullptr;
+    }
+    const auto size = sizeof(Header) + std::max<std::size_t>(slots, 1) * sizeof(Slot);
+
+    // A file of another catalogue, tolerance or layout is emptied before it is mapped
+    Header header{};
+    struct stat status {};
+    const bool valid = fstat(fd, &status) == 0 && static_cast<std::size_t>(status.st_size) == size &&
+                       pread(fd, &header, sizeof(header), 0) == sizeof(header) &&
+                       std::memcmp(header.magic, magic, sizeof(magic)) == 0 && header.version == version &&
+                       header.legs == legs && header.fingerprint == fingerprint && header.slots == slots;
+    const bool ready = valid || (ftruncate(fd, 0) == 0 && ftruncate(fd, static_cast<off_t>(size)) == 0);
+    void* data       = ready ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+    if (data == MAP_FAILED) {
+        close(fd);
+        return nullptr;
+    }
+
+    std::unique_ptr<Cache> cache(new Cache(path, fd, data, size, types));
+    if (!valid) {
+        auto& fresh       = cache->header();
+        fresh.version     = version;
+        fresh.legs        = legs;
+        fresh.fingerprint = fingerprint;
+        fresh.slots       = slots;
+        std::memcpy(fresh.magic, magic, sizeof(magic));
+    }
+    return cache;
+}
+
+Cache::Cache(std::filesystem::path path, int fd, void* data, std::size_t size, std::size_t types)
+    : path(std::move(path)), fd(fd), data(data), size(size), types(types) {}
+
+Cache::~Cache() {
+    munmap(data, size);
+    close(fd);  // and the lock with it
+}
+
+Cache::Header& Cache::header() const {
+    return *static_cast<Header*>(data);
+}
+
+Cache::Slot* Cache::slot(const std::vector<std::int64_t>& key) const {
+    if (key.size() > key_size) {
+        return nullptr;
+    }
+    auto* slots      = reinterpret_cast<Slot*>(static_cast<std::byte*>(data) + sizeof(Header));
+    const auto count = header().slots;
+    const auto hash  = Input::hash(key);
+    for (std::uint64_t probe = 0; probe < count; ++probe) {
+        auto& slot = slots[(hash + probe) % count];
+        if (slot.size == 0 ||
+            (slot.hash == hash && slot.size == key.size() && std::equal(key.begin(), key.end(), slot.key))) {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+std::optional<Cache::Result> Cache::find(const std::vector<std::int64_t>& key) {
+    std::lock_guard lock(mutex);
+    const auto* found = slot(key);
+    if (found == nullptr || found->size == 0 || (found->type != none && found->type >= types)) {
+        return std::nullopt;
+    }
+    return Result{found->type, {found->positions, found->positions + (found->size - 1) / 4}};
+}
+
+void Cache::add(const std::vector<std::int64_t>& key, const Result& result) {
+    std::lock_guard lock(mutex);
+    if (header().used * 4 >= header().slots * 3) {
+        return;
+    }
+    auto* empty = slot(key);
+    if (empty == nullptr || empty->size != 0) {
+        return;
+    }
+    empty->hash = Input::hash(key);
+    empty->type = result.type;
+    std::copy(key.begin(), key.end(), empty->key);
+    std::copy(result.positions.begin(), result.positions.end(), empty->positions);
+    empty->size = static_cast<std::uint32_t>(key.size());
+    ++header().used;
+}
@@ -0,0 +1,218 @@
+#include "combinations/Catalogue.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace {
+
+constexpr char magic[8]         = {'C', 'O', 'M', 'B', 'C', 'A', 'T', '\0'};
+constexpr std::uint32_t version = 3;
+
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t leg_size;  // layout of Leg, it differs between builds
+    std::uint64_t size;
+    std::uint64_t count;
+};
+
+struct Record {
+    std::uint64_t legs;  // offsets from the start of the image
+    std::uint64_t name;
+    std::uint64_t leg_count;
+    std::uint64_t name_size;
+    std::int64_t unit;
+    std::uint64_t min_count;
+    Catalogue::Kind kind;
+};
+
+std::size_t align(std::size_t offset) {
+    return (offset + alignof(Leg) - 1) / alignof(Leg) * alignof(Leg);
+}
+
+template <class T>
+T load(std::span<const std::byte> image, std::size_t offset) {
+    T value;
+    std::memcpy(&value, image.data() + offset, sizeof(T));
+    return value;
+}
+
+bool valid(const Record& record, std::uint64_t size) {
+    if (record.legs % alignof(Leg) != 0 || record.unit <= 0 || record.legs > size ||
+        record.leg_count > (size - record.legs) / sizeof(Leg) || record.name > size ||
+        record.name_size > size - record.name) {
+        return false;
+    }
+    switch (record.kind) {
+    case Catalogue::Kind::Fixed:
+    case Catalogue::Kind::Chain:
+    case Catalogue::Kind::Multiple:
+        [[fallthrough]];
+    case Catalogue::Kind::More:
+        return record.leg_count > 0;
+    default:
+        return false;
+    }
+}
+
+}  // anonymous namespace
+
+Catalogue::Mapping::Mapping(Mapping&& other) noexcept
+    : data(std::exchange(other.data, nullptr)), size(std::exchange(other.size, 0)) {}
+
+Catalogue::Mapping::~Mapping() {
+    if (data != nullptr) {
+        munmap(const_cast<std::byte*>(data), size);
+    }
+}
+
+std::vector<std::byte> Catalogue::compile(const std::vector<Entry>& entries) {
+    std::size_t legs = 0, names = 0;
+    for (const auto& entry : entries) {
+        legs += entry.legs.size();
+        names += entry.name.size();
+    }
+    const auto legs_offset  = align(sizeof(Header) + entries.size() * sizeof(Record));
+    const auto names_offset = legs_offset + legs * sizeof(Leg);
+    std::vector<std::byte> image(names_offset + names);
+
+    Header header{};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version  = version;
+    header.leg_size = sizeof(Leg);
+    header.size     = image.size();
+    header.count    = entries.size();
+    std::memcpy(image.data(), &header, sizeof(header));
+
+    auto leg = legs_offset, name = names_offset;
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        const auto& entry = entries[i];
+        Record record{};
+        record.legs      = leg;
+        record.name      = name;
+        record.leg_count = entry.legs.size();
+        record.name_size = entry.name.size();
+        record.unit      = entry.unit;
+        record.min_count = entry.min_count;
+        record.kind      = entry.kind;
+        std::memcpy(image.data() + sizeof(Header) + i * sizeof(Record), &record, sizeof(record));
+        std::memcpy(image.data() + leg, entry.legs.data(), entry.legs.size_bytes());
+        std::memcpy(image.data() + name, entry.name.data(), entry.name.size());
+        leg += entry.legs.size_bytes();
+        name += entry.name.size();
+    }
+    return image;
+}
+
+bool Catalogue::read(std::span<const std::byte> image, std::vector<Entry>& entries) {
+    if (image.size() < sizeof(Header) || reinterpret_cast<std::uintptr_t>(image.data()) % alignof(Leg) != 0) {
+        return false;
+    }
+    const auto header = load<Header>(image, 0);
+    if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != version ||
+        header.leg_size != sizeof(Leg) || header.size > image.size() || header.size < sizeof(Header) ||
+        header.count > (header.size - sizeof(Header)) / sizeof(Record)) {
+        return false;
+    }
+
+    std::vector<Entry> result;
+    result.reserve(header.count);
+    for (std::size_t i = 0; i < header.count; ++i) {
+        const auto record = load<Record>(image, sizeof(Header) + i * sizeof(Record));
+        if (!valid(record, header.size)) {
+            return false;
+        }
+        auto& entry = result.emplace_back(
+            Entry{record.kind,
+                  {reinterpret_cast<const Leg*>(image.data() + record.legs), record.leg_count},
+                  {reinterpret_cast<const char*>(image.data() + record.name), record.name_size},
+                  record.unit,
+                  record.min_count});
+        for (const auto& leg : entry.legs) {
+            entry.shape.add(leg.type);
+        }
+    }
+    entries.insert(entries.end(), result.begin(), result.end());
+    return true;
+}
+
+bool Catalogue::admits(const Entry& entry, const Signature& signature) {
+    switch (entry.kind) {
+    case Kind::Fixed:
+    case Kind::Chain:
+        return signature == entry.shape;
+    case Kind::Multiple:
+        return signature.size() > 0 && signature.size() % entry.legs.size() == 0 &&
+               signature == entry.shape.times(signature.size() / entry.legs.size());
+    case Kind::More: {
+        const auto type = entry.legs.front().type;
+        auto fitting    = signature.count(type);
+        if (type == InstrumentType::O) {
+            fitting += signature.count(InstrumentType::P) + signature.count(InstrumentType::C);
+        }
+        return signature.size() >= entry.min_count && fitting == signature.size();
+    }
+    }
+    return false;
+}
+
+Signature Catalogue::key(const Entry& entry) {
+    if (entry.kind == Kind::More) {
+        Signature result;
+        result.add(entry.legs.front().type);
+        return result;
+    }
+    return entry.kind == Kind::Multiple ? entry.shape.reduced() : entry.shape;
+}
+
+bool Catalogue::publish(const std::string& name, std::span<const std::byte> image) {
+    // A new segment, processes that attached to the previous one keep it until they unmap it
+    shm_unlink(name.c_str());
+    const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    void* data = ftruncate(fd, static_cast<off_t>(image.size())) == 0
+                     ? mmap(nullptr, image.size(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+                     : MAP_FAILED;
+    close(fd);
+    if (data == MAP_FAILED) {
+        shm_unlink(name.c_str());
+        return false;
+    }
+
+    // The magic goes last, a process attaching meanwhile finds no catalogue rather than a partial one
+    auto* bytes = static_cast<std::byte*>(data);
+    std::memcpy(bytes + sizeof(magic), image.data() + sizeof(magic), image.size() - sizeof(magic));
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(bytes, image.data(), sizeof(magic));
+    munmap(data, image.size());
+    return true;
+}
+
+std::optional<Catalogue::Mapping> Catalogue::attach(const std::string& name) {
+    const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return std::nullopt;
+    }
+    struct stat status {};
+    void* data = fstat(fd, &status) == 0 && status.st_size > 0
+                     ? mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_SHARED, fd, 0)
+                     : MAP_FAILED;
+    close(fd);
+    if (data == MAP_FAILED) {
+        return std::nullopt;
+    }
+    return Mapping(static_cast<const std::byte*>(data), static_cast<std::size_t>(status.st_size));
+}
+
+bool Catalogue::remove(const std::string& name) {
+    return shm_unlink(name.c_str()) == 0;
+}
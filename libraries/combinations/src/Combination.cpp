@@ -1,121 +1,650 @@
 #include "combinations/Combination.hpp"
 
 #include <algorithm>
+#include <limits>
 #include <numeric>
-#include <set>
 
-Combination::Combination(std::string&& name) : name(std::move(name)) {}
+namespace {
+
+// Largest number of components still matched faster by brute force, see benchmarks/calibrate.cpp
+constexpr std::size_t permutation_limit = 3;
+
+// Assignments one decomposition attempt may explore from a single first leg
+constexpr std::size_t extend_limit = 4096;
+// Assignments the repair pass of one type may explore over all its attempts
+constexpr std::size_t repair_limit = 16 * extend_limit;
+
+using Dimension = std::int32_t Leg::*;
+
+bool holds_letters(std::span<const Leg> legs, Dimension dimension) {
+    return std::all_of(legs.begin(), legs.end(),
+                       [dimension](const Leg& leg) { return leg.kind(dimension) == Leg::Letter; });
+}
+
+bool holds_chain(std::span<const Leg> legs, Dimension dimension) {
+    return legs.front().kind(dimension) == Leg::Letter &&
+           std::all_of(legs.begin() + 1, legs.end(),
+                       [dimension](const Leg& leg) { return leg.kind(dimension) == Leg::Offset; });
+}
+
+// Constraint the legs before position put on the given dimension of the leg at position, as in offset_check
+template <class T, class Value>
+Book::Bounds<T> bounds(std::span<const Leg> legs, const std::vector<int>& order, std::size_t position,
+                       Dimension dimension, Value value) {
+    Book::Bounds<T> result;
+    const auto& current = legs[position];
+    if (current.kind(dimension) == Leg::Letter) {
+        const auto letter = current.*dimension;
+        for (std::size_t k = 0; letter != '\0' && k < position; ++k) {
+            if (legs[k].kind(dimension) == Leg::Letter && legs[k].*dimension == letter) {
+                result.exact = value(order[k]);
+                break;
+            }
+        }
+        return result;
+    }
+    if (current.kind(dimension) != Leg::Offset) {
+        return result;
+    }
+    // Walk back through the offset group down to its base
+    const auto target = current.*dimension;
+    for (std::size_t k = position; k-- > 0;) {
+        const auto& other = legs[k];
+        if (other.kind(dimension) == Leg::Period) {
+            continue;
+        }
+        const auto offset = other.level(dimension);
+        const auto bound  = value(order[k]);
+        if (offset == target) {
+            result.exact = bound;
+            break;
+        }
+        if (offset < target && (!result.low || *result.low < bound)) {
+            result.low = bound;
+        }
+        if (offset > target && (!result.high || bound < *result.high)) {
+            result.high = bound;
+        }
+        if (other.kind(dimension) == Leg::Letter) {
+            break;
+        }
+    }
+    return result;
+}
+
+}  // anonymous namespace
+
+Combination::Combination(std::string_view name, std::int64_t unit) : name(name), unit(unit) {}
 
 bool Combination::check(const std::vector<Component>& components, std::vector<int>& order) {
-    return pre_check(components) && post_check(components, order);
+    Budget budget;
+    return check(Input(components), order, budget);
+}
+bool Combination::check(const Input& input, std::vector<int>& order, Budget& budget) {
+    return pre_check(input) && post_check(input, order, budget);
+}
+std::unique_ptr<Orders> Combination::enumerate(const Input& input) {
+    if (!pre_check(input)) {
+        return nullptr;
+    }
+    return orders(input);
+}
+std::size_t Combination::count(const Input& input) {
+    return pre_check(input) ? count_orders(input) : 0;
+}
+std::size_t Combination::count_orders(const Input& input) {
+    std::size_t result = 0;
+    std::vector<int> order;
+    for (const auto enumeration = orders(input); enumeration->next(order);) {
+        ++result;
+    }
+    return result;
 }
 
 // Fixed
-Fixed::Fixed(std::vector<Leg>&& legs, std::string&& string) : Multiple(std::move(legs), std::move(string)) {}
-bool Fixed::check_amount(const std::vector<Component>& components) {
-    return Multiple::legs.size() != components.size();
+Fixed::Fixed(std::span<const Leg> legs, std::string_view name, std::int64_t unit) : Multiple(legs, name, unit) {}
+bool Fixed::check_amount(std::size_t size) const {
+    return Multiple::legs.size() != size;
 }
 
 // Multiple
-Multiple::Multiple(std::vector<Leg>&& legs, std::string&& string)
-    : Combination(std::move(string)), legs(std::move(legs)) {}
-bool Multiple::check_amount(const std::vector<Component>& components) {
-    return components.size() % legs.size();
+Multiple::Multiple(std::span<const Leg> legs, std::string_view name, std::int64_t unit)
+    : Combination(name, unit), legs(legs) {}
+bool Multiple::check_amount(std::size_t size) const {
+    return size % legs.size();
 }
-bool Multiple::pre_check(const std::vector<Component>& components) {
-    if (check_amount(components)) {
+bool Multiple::pre_check(const Input& input) {
+    if (check_amount(input.size())) {
         return false;
     }
-    std::set<InstrumentType> set;
-    for (const auto& i : components) {
-        set.insert(i.type);
-    }
     for (const auto& i : legs) {
-        if (set.find(i.type) == set.end()) {
+        if (!input.contains(i.type)) {
+            return false;
+        }
+    }
+    return true;
+}
+Strategy Multiple::strategy(std::size_t size) const {
+    return size <= permutation_limit ? Strategy::Permutation : Strategy::Backtracking;
+}
+bool Multiple::check_permutation(const Input& input, const std::vector<int>& order) {
+    for (std::size_t i = 0; i < input.size(); i += legs.size()) {
+        if (!check_block(input, order, i, i + legs.size())) {
             return false;
         }
     }
     return true;
 }
-bool Multiple::check_permutation(const std::vector<Component>& components, const std::vector<int>& order) {
-    for (std::size_t i = 0; i < components.size(); i += legs.size()) {
-        std::map<char, double> strike;
-        std::map<int, double> strike_offset;
+bool Multiple::check_block(const Input& input, const std::vector<int>& order, std::size_t begin, std::size_t end) {
+    std::map<char, std::int64_t> strike;
+    std::map<int, std::int64_t> strike_offset;
 
-        std::map<char, Expiration> expiration;
-        std::map<int, Expiration> expiration_offset;
+    std::map<char, Expiration> expiration;
+    std::map<int, Expiration> expiration_offset;
+
+    for (std::size_t j = 0; j < end - begin; ++j) {
+        const auto i    = order[j + begin];
+        const auto& leg = legs[j];
+
+        if (!leg.fits(input.components[i].type) || !leg.fits_ratio(input, i, unit)) {
+            return false;
+        }
 
-        for (std::size_t j = 0; j < legs.size(); ++j) {
-            const auto& comb = components[order[j + i]];
-            const auto& leg  = legs[j];
+        if (!offset_check(strike, strike_offset, leg.kind(&Leg::strike), leg.strike, input.strikes[i])) {
+            return false;
+        }
 
-            if (comb.type != leg.type) {
+        if (leg.expiration_kind == Leg::Period) {
+            if (!expiration_offset[0].check_expiration(Period(leg.unit, leg.expiration), input.expirations[i])) {
+                return false;
+            }
+        } else {
+            if (!offset_check(expiration, expiration_offset, leg.kind(&Leg::expiration), leg.expiration,
+                              input.expirations[i])) {
                 return false;
             }
+        }
+    }
+    return true;
+}
+bool Multiple::post_check(const Input& input, std::vector<int>& order, Budget& budget) {
+    switch (strategy(input.size())) {
+    case Strategy::Permutation:
+        return permute(input, order, budget);
+    default:
+        return backtrack(input, order, budget);
+    }
+}
+bool Multiple::permute(const Input& input, std::vector<int>& order, Budget& budget) {
+    std::iota(order.begin(), order.end(), 0);
+    do {
+        if (!budget.spend()) {
+            return false;
+        }
+        if (check_permutation(input, order)) {
+            return true;
+        }
+    } while (std::next_permutation(order.begin(), order.end()));
+    return false;
+}
+struct Multiple::Search {
+    std::vector<std::vector<int>> candidates;  // components fitting each leg by type and ratio
+    std::vector<bool> used;
+    Budget& budget;
+};
+bool Multiple::backtrack(const Input& input, std::vector<int>& order, Budget& budget) {
+    Search state{{}, {}, budget};
+    state.candidates.resize(legs.size());
+    for (std::size_t j = 0; j < legs.size(); ++j) {
+        for (const auto i : input.of_type(legs[j].type)) {
+            if (legs[j].fits_ratio(input, i, unit)) {
+                state.candidates[j].push_back(i);
+            }
+        }
+        if (state.candidates[j].empty()) {
+            return false;
+        }
+    }
+    state.used.resize(input.size());
+    return search(input, order, state, 0);
+}
+bool Multiple::search(const Input& input, std::vector<int>& order, Search& state, std::size_t position) {
+    if (position == order.size()) {
+        return true;
+    }
+    const auto leg   = position % legs.size();
+    const auto begin = position - leg;
 
-            if (std::holds_alternative<double>(leg.ratio)) {
-                if (std::get<double>(leg.ratio) != comb.ratio) {
-                    return false;
-                }
-            } else {
-                if (std::get<bool>(leg.ratio) != (comb.ratio > 0)) {
-                    return false;
+    for (const auto i : state.candidates[leg]) {
+        // Blocks are interchangeable, so their first components go in increasing order
+        if (state.used[i] || (leg == 0 && begin > 0 && i < order[begin - legs.size()])) {
+            continue;
+        }
+        // Equal components are interchangeable too, the first unused one stands for all of them
+        bool twin = false;
+        for (auto j = input.twins[i]; !twin && j >= 0; j = input.twins[j]) {
+            twin = !state.used[j];
+        }
+        if (twin) {
+            continue;
+        }
+        if (!state.budget.spend()) {
+            return false;
+        }
+        order[position] = i;
+        if (!check_block(input, order, begin, position + 1)) {
+            continue;
+        }
+        state.used[i] = true;
+        if (search(input, order, state, position + 1)) {
+            return true;
+        }
+        state.used[i] = false;
+    }
+    return false;
+}
+
+struct Multiple::Enumeration: Orders {
+    Enumeration(Multiple& type, const Input& input)
+        : type(type), input(input), candidates(type.legs.size()), order(input.size()), cursors(input.size() + 1),
+          used(input.size()) {
+        for (std::size_t j = 0; j < type.legs.size(); ++j) {
+            for (const auto i : input.of_type(type.legs[j].type)) {
+                if (type.legs[j].fits_ratio(input, i, type.unit)) {
+                    candidates[j].push_back(i);
                 }
             }
+        }
+    }
 
-            if (!offset_check(strike, strike_offset, leg.strike, comb.strike)) {
+    bool next(std::vector<int>& result) override {
+        // Continue right after the order returned last time
+        if (depth == order.size() && !step_back()) {
+            return false;
+        }
+        while (true) {
+            if (depth == order.size()) {
+                result = order;
+                return true;
+            }
+            const auto leg  = depth % type.legs.size();
+            bool advanced   = false;
+            const auto& fit = candidates[leg];
+            while (!advanced && cursors[depth] < fit.size()) {
+                const auto i = fit[cursors[depth]++];
+                if (!used[i]) {
+                    order[depth] = i;
+                    advanced     = type.check_block(input, order, depth - leg, depth + 1);
+                }
+            }
+            if (advanced) {
+                used[order[depth]] = true;
+                cursors[++depth]   = 0;
+            } else if (!step_back()) {
                 return false;
             }
+        }
+    }
 
-            if (std::holds_alternative<Period>(leg.expiration)) {
-                if (!expiration_offset[0].check_expiration(std::get<Period>(leg.expiration),
-                                                           static_cast<Expiration>(comb.expiration))) {
-                    return false;
-                }
-            } else {
-                if (!offset_check(expiration, expiration_offset, leg.expiration, Expiration(comb.expiration))) {
-                    return false;
+    bool step_back() {
+        if (depth == 0) {
+            return false;
+        }
+        used[order[--depth]] = false;
+        return true;
+    }
+
+    Multiple& type;
+    const Input& input;
+    std::vector<std::vector<int>> candidates;
+    std::vector<int> order;
+    std::vector<std::size_t> cursors;  // next candidate to try at every depth
+    std::vector<bool> used;
+    std::size_t depth{0};
+};
+std::unique_ptr<Orders> Multiple::orders(const Input& input) {
+    return std::make_unique<Enumeration>(*this, input);
+}
+
+void Multiple::decompose(Book& book, std::vector<std::vector<int>>& parts) {
+    const auto first = parts.size();
+    std::vector<int> order(legs.size());
+    for (const auto anchor : book.find(legs.front().type, {}, {})) {
+        if (book.used[anchor] || !legs.front().fits_ratio(book.input, anchor, unit)) {
+            continue;
+        }
+        order.front() = anchor;
+        if (!check_block(book.input, order, 0, 1)) {
+            continue;
+        }
+        Budget budget;
+        budget.max_assignments = extend_limit;
+        book.used[anchor]      = true;
+        if (extend(book, order, 1, budget)) {
+            parts.push_back(order);
+        } else {
+            book.used[anchor] = false;
+        }
+    }
+    if (parts.size() > first) {
+        repair(book, parts, first);
+    }
+}
+
+// One leg an instance being repaired takes from an instance of the type found before
+struct Multiple::Repair {
+    const std::vector<int>& owners;  // instance of the type every component belongs to, -1 for none
+    int taken{-1};
+};
+
+// A first leg that is unused or another leg of an instance of the type may form an instance taking one leg of an
+// earlier instance, if that instance can be formed again from its own first leg without it. Every repair adds one
+// instance
+void Multiple::repair(Book& book, std::vector<std::vector<int>>& parts, std::size_t first) {
+    std::vector<int> owners(book.used.size(), -1);
+    for (auto p = first; p < parts.size(); ++p) {
+        for (const auto i : parts[p]) {
+            owners[i] = static_cast<int>(p);
+        }
+    }
+    std::vector<int> order(legs.size());
+    std::size_t spent = 0;
+    for (const auto anchor : book.find(legs.front().type, {}, {})) {
+        if (spent > repair_limit) {
+            break;
+        }
+        const auto owner = owners[anchor];
+        if ((book.used[anchor] && (owner < 0 || parts[owner].front() == anchor)) ||
+            !legs.front().fits_ratio(book.input, anchor, unit)) {
+            continue;
+        }
+        order.front() = anchor;
+        if (!check_block(book.input, order, 0, 1)) {
+            continue;
+        }
+        Repair repair{owners};
+        if (owner >= 0) {
+            repair.taken = anchor;
+        }
+        Budget budget;
+        budget.max_assignments = extend_limit;
+        book.used[anchor]      = true;
+        const bool found       = extend(book, order, 1, budget, &repair);
+        spent += budget.assignments;
+        if (!found) {
+            book.used[anchor] = owner >= 0;
+            continue;
+        }
+        if (repair.taken >= 0) {
+            const auto from    = owners[repair.taken];
+            const auto earlier = parts[from];
+            if (!reform(book, parts[from], repair.taken)) {
+                for (const auto i : order) {
+                    book.used[i] = book.used[i] && i == repair.taken;
                 }
+                continue;
             }
+            for (const auto i : earlier) {
+                owners[i] = -1;
+            }
+            for (const auto i : parts[from]) {
+                owners[i] = from;
+            }
+        }
+        for (const auto i : order) {
+            owners[i] = static_cast<int>(parts.size());
         }
+        parts.push_back(order);
     }
-    return true;
 }
-bool Multiple::post_check(const std::vector<Component>& components, std::vector<int>& order) {
-    std::iota(order.begin(), order.end(), 0);
-    if (check_permutation(components, order)) {
+
+// Forms the instance again from its first leg without the taken one, leaves it as it was if it cannot
+bool Multiple::reform(Book& book, std::vector<int>& part, int taken) {
+    if (part.front() == taken) {
+        return false;
+    }
+    for (std::size_t position = 1; position < part.size(); ++position) {
+        book.used[part[position]] = part[position] == taken;
+    }
+    auto order = part;
+    Budget budget;
+    budget.max_assignments = extend_limit;
+    if (extend(book, order, 1, budget)) {
+        part = std::move(order);
         return true;
     }
-    while (std::next_permutation(order.begin(), order.end())) {
-        if (check_permutation(components, order)) {
+    for (const auto i : part) {
+        book.used[i] = true;
+    }
+    return false;
+}
+
+bool Multiple::extend(Book& book, std::vector<int>& order, std::size_t position, Budget& budget, Repair* repair) {
+    if (position == legs.size()) {
+        return true;
+    }
+    const auto& leg       = legs[position];
+    const auto& input     = book.input;
+    const auto expiration = bounds<Expiration>(legs, order, position, &Leg::expiration,
+                                               [&input](int i) { return input.expirations[i]; });
+    const auto strike = bounds<std::int64_t>(legs, order, position, &Leg::strike,
+                                             [&input](int i) { return input.strikes[i]; });
+    for (const auto i : book.find(leg.type, expiration, strike)) {
+        // A repair runs on a mostly used book and also pays for the legs it skips
+        if (repair != nullptr && !budget.spend()) {
+            return false;
+        }
+        const bool take = book.used[i] && repair != nullptr && repair->taken < 0 && repair->owners[i] >= 0;
+        if ((book.used[i] && !take) || !leg.fits_ratio(input, i, unit)) {
+            continue;
+        }
+        if (repair == nullptr && !budget.spend()) {
+            return false;
+        }
+        order[position] = i;
+        if (!check_block(input, order, 0, position + 1)) {
+            continue;
+        }
+        if (take) {
+            repair->taken = i;
+        } else {
+            book.used[i] = true;
+        }
+        if (extend(book, order, position + 1, budget, repair)) {
             return true;
         }
+        if (take) {
+            repair->taken = -1;
+        } else {
+            book.used[i] = false;
+        }
     }
     return false;
 }
 
 // More
-More::More(Leg&& leg, std::string&& name, std::size_t min_count)
-    : Combination(std::move(name)), leg(leg), min_count(min_count) {}
-bool More::pre_check(const std::vector<Component>& components) {
-    return components.size() >= min_count;
+More::More(const Leg& leg, std::string_view name, std::int64_t unit, std::size_t min_count)
+    : Combination(name, unit), leg(leg), min_count(min_count) {
+    // Puts and calls are options too
+    if (leg.type == InstrumentType::O) {
+        this->leg.mask |= Leg::bit(InstrumentType::P) | Leg::bit(InstrumentType::C);
+    }
+}
+Strategy More::strategy(std::size_t) const {
+    return Strategy::Linear;
 }
-bool More::post_check(const std::vector<Component>& components, std::vector<int>& order) {
-    for (const auto& component : components) {
-        if (!(leg.type == component.type || (leg.type == InstrumentType::O && (component.type == InstrumentType::P ||
-                                                                               component.type == InstrumentType::C)))) {
+bool More::pre_check(const Input& input) {
+    return input.size() >= min_count;
+}
+bool More::post_check(const Input& input, std::vector<int>& order, Budget&) {
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        if (!fits(input, static_cast<int>(i))) {
             return false;
         }
-        if (std::holds_alternative<double>(leg.ratio)) {
-            if (std::get<double>(leg.ratio) != component.ratio) {
-                return false;
-            }
-        } else {
-            if (std::get<bool>(leg.ratio) != (component.ratio > 0)) {
-                return false;
-            }
-        }
     }
     std::iota(order.begin(), order.end(), 0);
     return true;
 }
+bool More::fits(const Input& input, int component) const {
+    return leg.fits(input.components[component].type) && leg.fits_ratio(input, component, unit);
+}
+void More::decompose(Book& book, std::vector<std::vector<int>>& parts) {
+    std::vector<int> part;
+    for (std::size_t i = 0; i < book.used.size(); ++i) {
+        if (!book.used[i] && fits(book.input, static_cast<int>(i))) {
+            part.push_back(static_cast<int>(i));
+        }
+    }
+    if (part.size() < min_count) {
+        return;
+    }
+    for (const auto i : part) {
+        book.used[i] = true;
+    }
+    parts.push_back(std::move(part));
+}
+struct More::Enumeration: Orders {
+    Enumeration(std::size_t size, bool valid) : order(size), valid(valid) {
+        std::iota(order.begin(), order.end(), 0);
+    }
+
+    bool next(std::vector<int>& result) override {
+        if (!valid) {
+            return false;
+        }
+        result = order;
+        valid  = std::next_permutation(order.begin(), order.end());
+        return true;
+    }
+
+    std::vector<int> order;
+    bool valid;
+};
+std::unique_ptr<Orders> More::orders(const Input& input) {
+    std::vector<int> order(input.size());
+    Budget budget;
+    return std::make_unique<Enumeration>(input.size(), post_check(input, order, budget));
+}
+std::size_t More::count_orders(const Input& input) {
+    std::vector<int> order(input.size());
+    Budget budget;
+    if (!post_check(input, order, budget)) {
+        return 0;
+    }
+    // Every order is valid
+    std::size_t result = 1;
+    for (std::size_t i = 2; i <= input.size(); ++i) {
+        if (result > std::numeric_limits<std::size_t>::max() / i) {
+            return std::numeric_limits<std::size_t>::max();
+        }
+        result *= i;
+    }
+    return result;
+}
+
+// Chain
+Chain::Chain(std::span<const Leg> legs, std::string_view name, std::int64_t unit)
+    : Fixed(legs, name, unit), by_strike(holds_chain(Multiple::legs, &Leg::strike)) {
+    uniform = std::all_of(Multiple::legs.begin(), Multiple::legs.end(), [this](const Leg& leg) {
+        return by_strike ? leg.expiration == Multiple::legs.front().expiration
+                         : leg.strike == Multiple::legs.front().strike;
+    });
+    positions.resize(Multiple::legs.size());
+    std::iota(positions.begin(), positions.end(), 0);
+    const auto key = [this](int position) {
+        const auto& leg = Multiple::legs[position];
+        return by_strike ? leg.level(&Leg::strike) : leg.level(&Leg::expiration);
+    };
+    std::stable_sort(positions.begin(), positions.end(), [&key](int a, int b) { return key(a) < key(b); });
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        if (i == 0 || key(positions[i - 1]) != key(positions[i])) {
+            bounds.push_back(i);
+        }
+    }
+    bounds.push_back(positions.size());
+}
+Strategy Chain::strategy(std::size_t) const {
+    return Strategy::Chain;
+}
+bool Chain::eligible(std::span<const Leg> legs) {
+    return legs.size() > 1 && ((holds_chain(legs, &Leg::strike) && holds_letters(legs, &Leg::expiration)) ||
+                               (holds_chain(legs, &Leg::expiration) && holds_letters(legs, &Leg::strike)));
+}
+bool Chain::post_check(const Input& input, std::vector<int>& order, Budget& budget) {
+    std::vector<int> sorted;
+    return sort_runs(input, sorted) && assign(input, order, sorted, 0, budget);
+}
+std::size_t Chain::count_orders(const Input& input) {
+    if (!uniform) {
+        return Fixed::count_orders(input);
+    }
+    // Any order that fits by type and ratio is valid as soon as one is, the count is a product over the levels
+    std::vector<int> sorted;
+    std::vector<int> order(input.size());
+    Budget budget;
+    if (!sort_runs(input, sorted) || !assign(input, order, sorted, 0, budget)) {
+        return 0;
+    }
+    std::size_t result = 1;
+    for (std::size_t run = 0; run + 1 < bounds.size(); ++run) {
+        const auto begin = sorted.begin() + bounds[run], end = sorted.begin() + bounds[run + 1];
+        std::sort(begin, end);
+        std::size_t fitting = 0;
+        do {
+            fitting += fits(input, sorted, run);
+        } while (std::next_permutation(begin, end));
+        result *= fitting;
+    }
+    return result;
+}
+bool Chain::sort_runs(const Input& input, std::vector<int>& sorted) {
+    const auto less = [this, &input](int a, int b) {
+        return by_strike ? input.strikes[a] < input.strikes[b]
+                         : input.expirations[a] < input.expirations[b];
+    };
+
+    // Distinct chain values have to line up with distinct offset levels one to one
+    sorted.resize(input.size());
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::stable_sort(sorted.begin(), sorted.end(), less);
+    for (std::size_t run = 0; run + 1 < bounds.size(); ++run) {
+        const auto begin = bounds[run], end = bounds[run + 1];
+        if (less(sorted[begin], sorted[end - 1]) || (end < sorted.size() && !less(sorted[end - 1], sorted[end]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Chain::fits(const Input& input, const std::vector<int>& sorted, std::size_t run) {
+    for (auto i = bounds[run]; i < bounds[run + 1]; ++i) {
+        const auto& leg = legs[positions[i]];
+        if (!leg.fits(input.components[sorted[i]].type) || !leg.fits_ratio(input, sorted[i], unit)) {
+            return false;
+        }
+    }
+    return true;
+}
+bool Chain::assign(const Input& input, std::vector<int>& order, std::vector<int>& sorted, std::size_t run,
+                   Budget& budget) {
+    if (run + 1 == bounds.size()) {
+        return check_permutation(input, order);
+    }
+    const auto begin = sorted.begin() + bounds[run], end = sorted.begin() + bounds[run + 1];
+    std::sort(begin, end);
+    do {
+        if (!budget.spend()) {
+            return false;
+        }
+        if (!fits(input, sorted, run)) {
+            continue;
+        }
+        for (auto i = bounds[run]; i < bounds[run + 1]; ++i) {
+            order[positions[i]] = sorted[i];
+        }
+        if (assign(input, order, sorted, run + 1, budget)) {
+            return true;
+        }
+    } while (std::next_permutation(begin, end));
+    return false;
+}
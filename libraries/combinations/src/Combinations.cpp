@@ -1,114 +1,733 @@
 #include "combinations/Combinations.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
 #include <cstring>
+#include <deque>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <thread>
 
+#include "combinations/Adaptive.hpp"
+#include "combinations/Analysis.hpp"
+#include "combinations/Book.hpp"
+#include "combinations/Cache.hpp"
+#include "combinations/Catalogue.hpp"
 #include "combinations/Combination.hpp"
 #include "combinations/DateTime.hpp"
+#include "combinations/Input.hpp"
+#include "combinations/SlowLog.hpp"
+#include "combinations/Unclassifiable.hpp"
 #include "pugixml.hpp"
 
-struct Combinations::Implementation {
-    std::vector<std::unique_ptr<Combination>> combinations;
+namespace {
 
-    void add(Combination* combination) { combinations.emplace_back(combination); }
+// Leg position of every component, starting from 1
+void to_positions(const std::vector<int>& order, std::vector<int>& positions) {
+    positions.resize(order.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        positions[order[i]] = static_cast<int>(i) + 1;
+    }
+}
+
+Signature signature_of(const std::vector<Component>& components) {
+    Signature signature;
+    for (const auto& component : components) {
+        signature.add(component.type);
+    }
+    return signature;
+}
+
+// Only what the resource uses: elements, attributes and the escapes in them
+constexpr unsigned int parse_options = pugi::parse_minimal | pugi::parse_escapes;
+
+// Combination elements a thread of load parses at least
+constexpr std::size_t parallel_grain = 1024;
+
+struct Parsed {
+    Catalogue::Kind kind;
+    std::vector<Leg> legs;
+    std::string name;
+    std::int64_t unit;
+    std::size_t min_count;
 };
 
-// =====================================================================================================================
+// Divides the ratios of the legs matching by value by their greatest common divisor, which is returned, so the type
+// and its multiples have the same legs
+std::int64_t normalise(std::vector<Leg>& legs, const std::vector<std::int64_t>& ticks) {
+    std::int64_t unit = 0;
+    for (std::size_t j = 0; j < legs.size(); ++j) {
+        if (!legs[j].sign) {
+            unit = std::gcd(unit, ticks[j]);
+        }
+    }
+    unit = std::max<std::int64_t>(unit, 1);
+    for (std::size_t j = 0; j < legs.size(); ++j) {
+        if (!legs[j].sign) {
+            legs[j].ratio = static_cast<std::int32_t>(ticks[j] / unit);
+        }
+    }
+    return unit;
+}
 
-Combinations::Combinations() : implementation(new Implementation()) {}
+// Type of one combination element, nullopt for an unknown cardinality
+std::optional<Parsed> parse(const pugi::xml_node& combination) {
+    const auto& nodes = combination.first_child();
 
-Combinations::~Combinations() = default;
+    std::vector<Leg> legs;
+    std::vector<std::int64_t> ticks;
+    for (const auto& node : nodes) {
+        auto& leg   = legs.emplace_back();
+        auto& ratio = ticks.emplace_back();
 
-bool Combinations::load(const std::filesystem::path& resource) {
-    pugi::xml_document doc;
-    doc.load_file(resource.c_str());
-    if (!doc) {
-        return false;
+        // Type
+        leg.type = static_cast<InstrumentType>(node.attribute("type").value()[0]);
+        leg.mask = Leg::bit(leg.type);
+
+        // Ratio
+        const auto& value = node.attribute("ratio");
+        if (value.value()[0] == '+') {
+            leg.sign  = true;
+            leg.ratio = 1;
+        } else if (value.value()[0] == '-' && value.value()[1] == '\0') {
+            leg.sign  = true;
+            leg.ratio = -1;
+        } else {
+            ratio = Tolerance::ratio_of(value.as_double());
+        }
+
+        // Strike
+        if (const auto& strike = node.attribute("strike")) {
+            leg.strike = strike.value()[0];
+
+        } else if (const auto& strike_offset = node.attribute("strike_offset")) {
+            int tmp         = static_cast<int>(std::strlen(strike_offset.value()));
+            leg.strike_kind = Leg::Offset;
+            leg.strike      = strike_offset.value()[0] == '-' ? -tmp : tmp;
+        }
+
+        // Expiration
+        const auto& expiration = node.attribute("expiration");
+        if (expiration) {
+            leg.expiration = expiration.value()[0];
+
+        } else if (const auto& expiration_offset = node.attribute("expiration_offset")) {
+            if (expiration_offset.value()[0] == '+' || expiration_offset.value()[0] == '-') {
+                int tmp             = static_cast<int>(std::strlen(expiration_offset.value()));
+                leg.expiration_kind = Leg::Offset;
+                leg.expiration      = expiration_offset.value()[0] == '+' ? tmp : -tmp;
+            } else {
+                char* durPtr;
+                int tmp = std::strtol(expiration_offset.value(), &durPtr, 10);
+                if (!tmp) {
+                    ++tmp;
+                }
+                leg.expiration_kind = Leg::Period;
+                leg.unit            = static_cast<OffsetType>(*durPtr);
+                leg.expiration      = tmp;
+            }
+        }
     }
 
+    std::string cardinality = nodes.attribute("cardinality").value();
+    std::string name        = combination.attribute("name").value();
+    const auto unit         = normalise(legs, ticks);
+
+    switch (cardinality[1]) {
+    case 'o':  // More
+        return Parsed{Catalogue::Kind::More, std::move(legs), std::move(name), unit,
+                      nodes.attribute("mincount").as_ullong()};
+    case 'i':  // Fixed
+        return Parsed{Chain::eligible(legs) ? Catalogue::Kind::Chain : Catalogue::Kind::Fixed, std::move(legs),
+                      std::move(name), unit, 0};
+    case 'u':  // Multiply
+        return Parsed{Catalogue::Kind::Multiple, std::move(legs), std::move(name), unit, 0};
+    }
+    return std::nullopt;
+}
+
+// Types of the resource in priority order. The elements are independent, a large resource is parsed by a thread per
+// core over contiguous ranges of them
+bool parse(const pugi::xml_document& doc, std::vector<Parsed>& parsed) {
     const auto combinations = doc.child("combinations");
     if (!combinations) {
         return false;
     }
 
-    for (const auto& combination : combinations) {
-        const auto& nodes = combination.first_child();
+    std::vector<pugi::xml_node> nodes(combinations.begin(), combinations.end());
+    std::vector<std::optional<Parsed>> types(nodes.size());
+    const auto parse_range = [&nodes, &types](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            types[i] = parse(nodes[i]);
+        }
+    };
+
+    const std::size_t threads =
+        std::min<std::size_t>(std::thread::hardware_concurrency(), nodes.size() / parallel_grain);
+    if (threads > 1) {
+        std::vector<std::thread> pool;
+        const auto chunk = (nodes.size() + threads - 1) / threads;
+        for (std::size_t begin = 0; begin < nodes.size(); begin += chunk) {
+            pool.emplace_back(parse_range, begin, std::min(begin + chunk, nodes.size()));
+        }
+        for (auto& thread : pool) {
+            thread.join();
+        }
+    } else {
+        parse_range(0, nodes.size());
+    }
+
+    for (auto& type : types) {
+        if (type) {
+            parsed.push_back(std::move(*type));
+        }
+    }
+    return true;
+}
 
-        std::vector<Leg> legs;
-        for (const auto& node : nodes) {
-            auto& leg = legs.emplace_back();
+}  // anonymous namespace
 
-            // Type
-            leg.type = static_cast<InstrumentType>(node.attribute("type").value()[0]);
+struct Combinations::Implementation {
+    std::vector<std::vector<std::byte>> images;  // compiled by load
+    std::vector<Catalogue::Mapping> mappings;    // attached
+    std::vector<Catalogue::Entry> entries;       // of the types in priority order
+    std::map<Signature, std::vector<std::size_t>> index;  // positions of the types by their key
 
-            // Ratio
-            const auto& ratio = node.attribute("ratio");
-            if (ratio.value()[0] == '+') {
-                leg.ratio = true;
-            } else if (ratio.value()[0] == '-' && ratio.value()[1] == '\0') {
-                leg.ratio = false;
-            } else {
-                leg.ratio = ratio.as_double();
+    // Matchers of the entries kept by value, a deque does not move them as more are added
+    std::deque<Fixed> fixed;
+    std::deque<Chain> chains;
+    std::deque<Multiple> multiples;
+    std::deque<More> mores;
+    std::vector<Combination*> combinations;  // of the entries at the same positions
+    Tolerance tolerance;
+    Analysis analysis;                               // of the entries with the tolerance, redone as either changes
+    std::unique_ptr<Adaptive> adaptive;              // order of classify when it adapts, redone with the analysis
+    std::unique_ptr<Unclassifiable> unclassifiable;  // inputs classify found no type for, emptied with the analysis
+    std::unique_ptr<Cache> cache;                    // of classify, reopened for the new fingerprint
+    std::unique_ptr<SlowLog> slow_log;               // of classify calls over its threshold
+
+    void analyse() {
+        analysis = Analysis(entries, tolerance);
+        if (adaptive) {
+            adaptive = std::make_unique<Adaptive>(entries, analysis);
+        }
+        if (unclassifiable) {
+            unclassifiable = std::make_unique<Unclassifiable>();
+        }
+        if (cache) {
+            const auto path = cache->path;
+            cache.reset();
+            cache = Cache::open(path, fingerprint(), combinations.size());
+        }
+    }
+
+    // Of the types and the tolerance, all a classification depends on but the input
+    std::uint64_t fingerprint() const {
+        const auto image = Catalogue::compile(entries);
+        std::vector<std::int64_t> words((image.size() + 7) / 8 + 3);
+        std::memcpy(words.data(), image.data(), image.size());
+        words[words.size() - 3] = std::bit_cast<std::int64_t>(tolerance.ratio);
+        words[words.size() - 2] = std::bit_cast<std::int64_t>(tolerance.strike);
+        words[words.size() - 1] = tolerance.scaled;
+        return Input::hash(words);
+    }
+
+    void add(const Catalogue::Entry& entry, Combination& matcher) {
+        index[Catalogue::key(entry)].push_back(combinations.size());
+        combinations.push_back(&matcher);
+    }
+
+    // Adds the types of the document over a newly compiled image, the same one share publishes
+    bool load(const pugi::xml_document& doc) {
+        std::vector<Parsed> parsed;
+        if (!parse(doc, parsed)) {
+            return false;
+        }
+        std::vector<Catalogue::Entry> entries;
+        for (const auto& type : parsed) {
+            entries.push_back({type.kind, type.legs, type.name, type.unit, type.min_count, {}});
+        }
+        return add(images.emplace_back(Catalogue::compile(entries)));
+    }
+
+    // Makes the types of the image, it has to outlive them
+    bool add(std::span<const std::byte> image) {
+        const auto first = entries.size();
+        if (!Catalogue::read(image, entries)) {
+            return false;
+        }
+        for (auto i = first; i < entries.size(); ++i) {
+            const auto& entry = entries[i];
+            switch (entry.kind) {
+            case Catalogue::Kind::Fixed:
+                add(entry, fixed.emplace_back(entry.legs, entry.name, entry.unit));
+                break;
+            case Catalogue::Kind::Chain:
+                add(entry, chains.emplace_back(entry.legs, entry.name, entry.unit));
+                break;
+            case Catalogue::Kind::Multiple:
+                add(entry, multiples.emplace_back(entry.legs, entry.name, entry.unit));
+                break;
+            case Catalogue::Kind::More:
+                add(entry, mores.emplace_back(entry.legs.front(), entry.name, entry.unit, entry.min_count));
+                break;
             }
+        }
+        analyse();
+        return true;
+    }
 
-            // Strike
-            if (const auto& strike = node.attribute("strike")) {
-                leg.strike = strike.value()[0];
+    // Whether a candidate may be the first match of the input: a shadowed type never is and a type whose profile the
+    // input does not fit matches in no order
+    bool viable(std::size_t i, const Input& input) const {
+        return analysis.shadowed[i] == Analysis::none && analysis.profiles[i].admits(input);
+    }
 
-            } else if (const auto& strike_offset = node.attribute("strike_offset")) {
-                int tmp    = static_cast<int>(std::strlen(strike_offset.value()));
-                leg.strike = strike_offset.value()[0] == '-' ? -tmp : tmp;
+    // Positions of the types that admit the signature in priority order. Only the keys a type admitting it may have
+    // are looked up: the signature itself, its reduced form and the one of a More of options. The entries are checked
+    // on their kind alone, the matchers are not touched
+    std::vector<std::size_t> candidates(const Signature& signature) const {
+        std::vector<std::size_t> result;
+        if (signature.size() == 0) {
+            for (std::size_t i = 0; i < entries.size(); ++i) {
+                if (Catalogue::admits(entries[i], signature)) {
+                    result.push_back(i);
+                }
             }
+            return result;
+        }
 
-            // Expiration
-            const auto& expiration = node.attribute("expiration");
-            if (expiration) {
-                leg.expiration = expiration.value()[0];
-
-            } else if (const auto& expiration_offset = node.attribute("expiration_offset")) {
-                if (expiration_offset.value()[0] == '+' || expiration_offset.value()[0] == '-') {
-                    int tmp        = static_cast<int>(std::strlen(expiration_offset.value()));
-                    leg.expiration = expiration_offset.value()[0] == '+' ? tmp : -tmp;
-                } else {
-                    char* durPtr;
-                    int tmp = std::strtol(expiration_offset.value(), &durPtr, 10);
-                    if (!tmp) {
-                        ++tmp;
+        std::vector<Signature> keys = {signature, signature.reduced()};
+        const auto options          = signature.count(InstrumentType::O) + signature.count(InstrumentType::P) +
+                             signature.count(InstrumentType::C);
+        if (options == signature.size()) {
+            keys.emplace_back().add(InstrumentType::O);
+        }
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        for (const auto& key : keys) {
+            if (const auto found = index.find(key); found != index.end()) {
+                for (const auto i : found->second) {
+                    if (Catalogue::admits(entries[i], signature)) {
+                        result.push_back(i);
                     }
-                    leg.expiration = Period(static_cast<OffsetType>(*durPtr), tmp);
                 }
             }
         }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
 
-        std::string cardinality = nodes.attribute("cardinality").value();
-        std::string name        = combination.attribute("name").value();
+    Combination* find(const std::string& name) const {
+        const auto i = position(name);
+        return i < combinations.size() ? combinations[i] : nullptr;
+    }
 
-        switch (cardinality[1]) {
-        case 'o':  // More
-            implementation->add(new More(std::move(legs[0]), std::move(name), nodes.attribute("mincount").as_ullong()));
-            break;
-        case 'i':  // Fixed
-            implementation->add(new Fixed(std::move(legs), std::move(name)));
-            break;
-        case 'u':  // Multiply
-            implementation->add(new Multiple(std::move(legs), std::move(name)));
-            break;
+    // Of the first type of the name, the number of types if there is none
+    std::size_t position(const std::string& name) const {
+        std::size_t i = 0;
+        while (i < entries.size() && entries[i].name != name) {
+            ++i;
+        }
+        return i;
+    }
+};
+
+// Matches
+Combinations::Matches::Matches(const Implementation& implementation, const std::vector<Component>& components)
+    : implementation(implementation)
+    , input(new Input(components, implementation.tolerance))
+    , candidates(implementation.candidates(signature_of(components))) {}
+
+Combinations::Matches::Matches(Matches&&) noexcept = default;
+
+Combinations::Matches::~Matches() = default;
+
+std::optional<Match> Combinations::Matches::next() {
+    std::vector<int> order(input->size());
+    Budget budget;
+    while (position < candidates.size()) {
+        const auto i = candidates[position++];
+        if (!implementation.analysis.profiles[i].admits(*input)) {
+            continue;
+        }
+        const auto& comb = implementation.combinations[i];
+        if (comb->check(*input, order, budget)) {
+            Match match{std::string(comb->name), {}};
+            to_positions(order, match.order);
+            return match;
         }
     }
+    return std::nullopt;
+}
+
+// Orderings
+Combinations::Orderings::Orderings(Combination* combination, const std::vector<Component>& components,
+                                    const Tolerance& tolerance)
+    : input(new Input(components, tolerance)) {
+    if (combination != nullptr) {
+        orders = combination->enumerate(*input);
+    }
+}
+
+Combinations::Orderings::Orderings(Orderings&&) noexcept = default;
+
+Combinations::Orderings::~Orderings() = default;
+
+std::optional<std::vector<int>> Combinations::Orderings::next() {
+    std::vector<int> order;
+    if (orders == nullptr || !orders->next(order)) {
+        return std::nullopt;
+    }
+    std::vector<int> positions;
+    to_positions(order, positions);
+    return positions;
+}
+
+// ClassificationSession
+Combinations::ClassificationSession::ClassificationSession(const Implementation& implementation)
+    : implementation(implementation) {}
+
+Combinations::ClassificationSession::ClassificationSession(ClassificationSession&&) noexcept = default;
+
+Combinations::ClassificationSession::~ClassificationSession() = default;
+
+std::size_t Combinations::ClassificationSession::add(const Component& component) {
+    legs.push_back(component);
+    signature.add(component.type);
+    reshaped = changed = true;
+    return legs.size() - 1;
+}
+
+bool Combinations::ClassificationSession::remove(std::size_t position) {
+    if (position >= legs.size()) {
+        return false;
+    }
+    signature.remove(legs[position].type);
+    legs.erase(legs.begin() + static_cast<std::ptrdiff_t>(position));
+    reshaped = changed = true;
+    return true;
+}
+
+bool Combinations::ClassificationSession::modify(std::size_t position, const Component& component) {
+    if (position >= legs.size()) {
+        return false;
+    }
+    if (legs[position].type != component.type) {
+        signature.remove(legs[position].type);
+        signature.add(component.type);
+        reshaped = true;
+    }
+    legs[position] = component;
+    changed        = true;
+    return true;
+}
+
+const std::string& Combinations::ClassificationSession::current(std::vector<int>& order) {
+    if (reshaped) {
+        candidates = implementation.candidates(signature);
+        reshaped   = false;
+    }
+    if (changed) {
+        name = "Unclassified";
+        positions.clear();
+        const Input input(legs, implementation.tolerance);
+        std::vector<int> tmp_order(legs.size());
+        Budget budget;
+        for (const auto i : candidates) {
+            if (!implementation.viable(i, input)) {
+                continue;
+            }
+            const auto& comb = implementation.combinations[i];
+            if (comb->check(input, tmp_order, budget)) {
+                to_positions(tmp_order, positions);
+                name = comb->name;
+                break;
+            }
+        }
+        changed = false;
+    }
+    order = positions;
+    return name;
+}
+
+// =====================================================================================================================
+
+Combinations::Combinations() : implementation(new Implementation()) {}
+
+Combinations::~Combinations() = default;
+
+void Combinations::set_tolerance(const Tolerance& tolerance) {
+    implementation->tolerance = tolerance;
+    implementation->analyse();
+}
+
+void Combinations::set_adaptive(bool adaptive) {
+    implementation->adaptive =
+        adaptive ? std::make_unique<Adaptive>(implementation->entries, implementation->analysis) : nullptr;
+}
+
+void Combinations::set_unclassified_filter(bool filter) {
+    implementation->unclassifiable = filter ? std::make_unique<Unclassifiable>() : nullptr;
+}
+
+bool Combinations::open_slow_log(const std::filesystem::path& path, std::chrono::nanoseconds threshold) {
+    implementation->slow_log = SlowLog::open(path, threshold);
+    return implementation->slow_log != nullptr;
+}
+
+std::size_t Combinations::slow_log_dropped() const {
+    return implementation->slow_log ? implementation->slow_log->dropped() : 0;
+}
+
+bool Combinations::open_cache(const std::filesystem::path& path) {
+    implementation->cache.reset();
+    implementation->cache = Cache::open(path, implementation->fingerprint(), implementation->combinations.size());
+    return implementation->cache != nullptr;
+}
+
+bool Combinations::load(const std::filesystem::path& resource) {
+    // Mapped copy-on-write and parsed in place
+    const int fd = ::open(resource.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat status {};
+    const auto size = fstat(fd, &status) == 0 ? static_cast<std::size_t>(status.st_size) : 0;
+    void* data      = size > 0 ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+    pugi::xml_document doc;
+    const bool loaded = doc.load_buffer_inplace(data, size, parse_options) && implementation->load(doc);
+    munmap(data, size);
+    return loaded;
+}
+
+bool Combinations::load_buffer(std::span<const char> resource) {
+    pugi::xml_document doc;
+    return doc.load_buffer(resource.data(), resource.size(), parse_options) && implementation->load(doc);
+}
+
+bool Combinations::load_image(std::span<const std::byte> image) {
+    return implementation->add(image);
+}
+
+std::vector<std::byte> Combinations::image() const {
+    return Catalogue::compile(implementation->entries);
+}
+
+bool Combinations::share(const std::string& name) const {
+    return Catalogue::publish(name, image());
+}
+
+bool Combinations::attach(const std::string& name) {
+    auto mapping = Catalogue::attach(name);
+    if (!mapping || !implementation->add(mapping->image())) {
+        return false;
+    }
+    implementation->mappings.push_back(std::move(*mapping));
     return true;
 }
 
 std::string Combinations::classify(const std::vector<Component>& components, std::vector<int>& order) const {
+    Budget budget;
+    return classify(components, order, budget).name;
+}
+
+Classification Combinations::classify(const std::vector<Component>& components, std::vector<int>& order,
+                                      Budget& budget) const {
+    auto* slow_log = implementation->slow_log.get();
+    if (slow_log == nullptr) {
+        return match(components, order, budget);
+    }
+    const auto start   = std::chrono::steady_clock::now();
+    auto result        = match(components, order, budget);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    if (elapsed > slow_log->threshold) {
+        slow_log->add(components, result.name, elapsed);
+    }
+    return result;
+}
+
+Classification Combinations::match(const std::vector<Component>& components, std::vector<int>& order,
+                                   Budget& budget) const {
+    Classification result;
+    const Input input(components, implementation->tolerance);
     std::vector<int> tmp_order(components.size());
 
-    for (const auto& comb : implementation->combinations) {
-        if (comb->check(components, tmp_order)) {
-            order.resize(tmp_order.size());
-            for (std::size_t i = 0; i < tmp_order.size(); ++i) {
-                order[tmp_order[i]] = static_cast<int>(i) + 1;
+    // An input equal to a known one up to the order of its components has its result. Its order is the one the type
+    // finds first for these components, as without the cache, or the kept one mapped through the canonical order
+    // should the budget not suffice
+    auto* unclassifiable = implementation->unclassifiable.get();
+    auto* cache          = implementation->cache.get();
+    std::vector<int> canonical;
+    std::vector<std::int64_t> key;
+    if (unclassifiable != nullptr || cache != nullptr) {
+        canonical = input.canonical();
+        key       = input.key(canonical);
+    }
+    if (cache != nullptr) {
+        if (const auto found = cache->find(key)) {
+            result.cached = true;
+            if (found->type == Cache::none) {
+                result.name = "Unclassified";
+                return result;
+            }
+            const auto& comb = implementation->combinations[found->type];
+            ++result.evaluated;
+            if (comb->check(input, tmp_order, budget)) {
+                to_positions(tmp_order, order);
+            } else {
+                order.resize(components.size());
+                for (std::size_t k = 0; k < canonical.size(); ++k) {
+                    order[canonical[k]] = found->positions[k];
+                }
+            }
+            result.status = Classification::Status::Classified;
+            result.name   = comb->name;
+            result.scale  = input.scaled ? static_cast<double>(input.scale) / static_cast<double>(comb->unit) : 1;
+            return result;
+        }
+    }
+    if (unclassifiable != nullptr && unclassifiable->contains(key)) {
+        result.name = "Unclassified";
+        return result;
+    }
+
+    // Candidates in priority order or in the adapted one, which finds the same first match
+    const auto signature = signature_of(components);
+    auto* adaptive       = implementation->adaptive.get();
+    std::shared_ptr<const std::vector<std::size_t>> candidates;
+    if (adaptive != nullptr) {
+        candidates = adaptive->find(signature);
+        if (candidates == nullptr) {
+            candidates = adaptive->add(signature, implementation->candidates(signature));
+        }
+    } else {
+        candidates = std::make_shared<const std::vector<std::size_t>>(implementation->candidates(signature));
+    }
+
+    for (const auto i : *candidates) {
+        if (!implementation->viable(i, input)) {
+            continue;
+        }
+        const auto& comb = implementation->combinations[i];
+        if (comb->check(input, tmp_order, budget)) {
+            to_positions(tmp_order, order);
+            result.status = Classification::Status::Classified;
+            result.name   = comb->name;
+            result.scale  = input.scaled ? static_cast<double>(input.scale) / static_cast<double>(comb->unit) : 1;
+            ++result.evaluated;
+            if (adaptive != nullptr) {
+                adaptive->count(i);
             }
-            return comb->name;
+            if (cache != nullptr) {
+                Cache::Result cached{static_cast<std::uint32_t>(i), {}};
+                for (const auto k : canonical) {
+                    cached.positions.push_back(order[k]);
+                }
+                cache->add(key, cached);
+            }
+            return result;
+        }
+        if (budget.exceeded) {
+            result.status = Classification::Status::BudgetExceeded;
+            result.name   = "Budget exceeded";
+            break;
         }
+        ++result.evaluated;
     }
 
-    return "Unclassified";
+    if (adaptive != nullptr) {
+        adaptive->count(Analysis::none);
+    }
+    if (result.status != Classification::Status::BudgetExceeded) {
+        result.name = "Unclassified";
+        if (cache != nullptr) {
+            cache->add(key, {Cache::none, {}});
+        }
+        if (unclassifiable != nullptr) {
+            unclassifiable->add(std::move(key));
+        }
+    }
+    return result;
+}
+
+Combinations::ClassificationSession Combinations::session() const {
+    return ClassificationSession(*implementation);
+}
+
+Combinations::Matches Combinations::matches(const std::vector<Component>& components) const {
+    return {*implementation, components};
+}
+
+std::vector<Match> Combinations::classify_all(const std::vector<Component>& components) const {
+    std::vector<Match> result;
+    auto matches = this->matches(components);
+    while (auto match = matches.next()) {
+        result.push_back(std::move(*match));
+    }
+    return result;
+}
+
+Combinations::Orderings Combinations::orderings(const std::string& name,
+                                                const std::vector<Component>& components) const {
+    return {implementation->find(name), components, implementation->tolerance};
+}
+
+std::size_t Combinations::count_orderings(const std::string& name, const std::vector<Component>& components) const {
+    auto* comb = implementation->find(name);
+    return comb != nullptr ? comb->count(Input(components, implementation->tolerance)) : 0;
+}
+
+Decomposition Combinations::decompose(const std::vector<Component>& components) const {
+    Decomposition result;
+    Book book(components, implementation->tolerance);
+    std::vector<std::vector<int>> parts;
+    for (const auto& comb : implementation->combinations) {
+        comb->decompose(book, parts);
+        for (auto& part : parts) {
+            result.parts.push_back({std::string(comb->name), std::move(part)});
+        }
+        parts.clear();
+    }
+    for (std::size_t i = 0; i < components.size(); ++i) {
+        if (!book.used[i]) {
+            result.leftover.push_back(static_cast<int>(i));
+        }
+    }
+    return result;
+}
+
+std::vector<Shadowed> Combinations::shadowed() const {
+    std::vector<Shadowed> result;
+    const auto& entries = implementation->entries;
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        if (const auto by = implementation->analysis.shadowed[i]; by != Analysis::none) {
+            result.push_back({std::string(entries[i].name), std::string(entries[by].name)});
+        }
+    }
+    return result;
+}
+
+bool Combinations::exclusive(const std::string& a, const std::string& b) const {
+    const auto i    = implementation->position(a), j = implementation->position(b);
+    const auto size = implementation->entries.size();
+    return i < size && j < size && implementation->analysis.exclusive(implementation->entries, i, j);
+}
+
+std::optional<Strategy> Combinations::strategy(const std::string& name, std::size_t size) const {
+    if (const auto* comb = implementation->find(name)) {
+        return comb->strategy(size);
+    }
+    return std::nullopt;
 }
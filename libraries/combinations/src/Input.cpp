@@ -0,0 +1,107 @@
+#include "combinations/Input.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <tuple>
+
+namespace {
+
+template <class T>
+int distinct(std::vector<T> values) {
+    std::sort(values.begin(), values.end());
+    return static_cast<int>(std::unique(values.begin(), values.end()) - values.begin());
+}
+
+// Sum saturating at the limits of the type, where it is no longer known
+std::int64_t saturating_add(std::int64_t a, std::int64_t b) {
+    std::int64_t result;
+    if (__builtin_add_overflow(a, b, &result)) {
+        return b < 0 ? std::numeric_limits<std::int64_t>::min() : std::numeric_limits<std::int64_t>::max();
+    }
+    return result;
+}
+
+}  // anonymous namespace
+
+Input::Input(const std::vector<Component>& components, const Tolerance& tolerance)
+    : components(components), scaled(tolerance.scaled), ratio_epsilon(scaled ? 0 : tolerance.ratio_epsilon()) {
+    expirations.reserve(components.size());
+    ratios.reserve(components.size());
+    positive.reserve(components.size());
+    strikes.reserve(components.size());
+    for (std::size_t i = 0; i < components.size(); ++i) {
+        expirations.emplace_back(components[i].expiration);
+        ratios.push_back(Tolerance::ratio_of(components[i].ratio));
+        positive.push_back(components[i].ratio > 0);
+        strikes.push_back(tolerance.strike_of(components[i].strike));
+        types[Signature::index(components[i].type)].push_back(static_cast<int>(i));
+    }
+    // Saturated ratios are no multiples of anything, the input keeps its ticks. The others are far from the limits of
+    // std::gcd, which is undefined for a value whose magnitude does not fit
+    const auto saturated = std::any_of(ratios.begin(), ratios.end(), [](std::int64_t ratio) {
+        return ratio == Tolerance::max_ratio || ratio == -Tolerance::max_ratio;
+    });
+    if (scaled && !saturated) {
+        scale = 0;
+        for (const auto ratio : ratios) {
+            scale = std::gcd(scale, ratio);
+        }
+        scale = std::max<std::int64_t>(scale, 1);
+        for (auto& ratio : ratios) {
+            ratio /= scale;
+        }
+    }
+    for (std::size_t i = 0; i < components.size(); ++i) {
+        const auto type = Signature::index(components[i].type);
+        ++counts[type];
+        positives[type] += positive[i];
+        sums[type] = saturating_add(sums[type], ratios[i]);
+    }
+    strike_values     = distinct(strikes);
+    expiration_values = distinct(expirations);
+
+    // Components equal once quantised are interchangeable
+    const auto sorted = canonical();
+    twins.assign(components.size(), -1);
+    for (std::size_t i = 1; i < sorted.size(); ++i) {
+        if (!less(sorted[i - 1], sorted[i])) {
+            twins[sorted[i]] = sorted[i - 1];
+        }
+    }
+}
+
+bool Input::less(int a, int b) const {
+    return std::tie(components[a].type, ratios[a], positive[a], strikes[a], expirations[a]) <
+           std::tie(components[b].type, ratios[b], positive[b], strikes[b], expirations[b]);
+}
+
+std::vector<int> Input::canonical() const {
+    std::vector<int> sorted(components.size());
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::stable_sort(sorted.begin(), sorted.end(), [this](int a, int b) { return less(a, b); });
+    return sorted;
+}
+
+std::vector<std::int64_t> Input::key(const std::vector<int>& canonical) const {
+    std::vector<std::int64_t> result{scale};
+    result.reserve(1 + 4 * canonical.size());
+    for (const auto i : canonical) {
+        const auto type = static_cast<std::int64_t>(components[i].type) << 1 | positive[i];
+        result.insert(result.end(), {type, ratios[i], strikes[i], expirations[i].number()});
+    }
+    return result;
+}
+
+std::uint64_t Input::hash(const std::vector<std::int64_t>& key) {
+    std::uint64_t result = key.size();
+    for (const auto value : key) {
+        result = (result ^ static_cast<std::uint64_t>(value)) * 0x9e3779b97f4a7c15;
+        result ^= result >> 29;
+    }
+    return result;
+}
+
+const std::vector<int>& Input::of_type(InstrumentType type) const {
+    return types[Signature::index(type)];
+}
@@ -0,0 +1,225 @@
+#include "combinations/Protocol.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <type_traits>
+
+namespace {
+
+// Unsigned integer with the bits of the value
+template <class T>
+using Bits = typename std::conditional_t<std::is_floating_point_v<T>, std::type_identity<std::uint64_t>,
+                                         std::make_unsigned<T>>::type;
+
+template <class T>
+void put(std::string& out, T value) {
+    std::uint64_t bits = std::bit_cast<Bits<T>>(value);
+    for (std::size_t i = 0; i < sizeof(T); ++i, bits >>= 8) {
+        out.push_back(static_cast<char>(bits & 0xFF));
+    }
+}
+
+struct Reader {
+    std::string_view data;
+    bool failed = false;
+
+    template <class T>
+    T get() {
+        if (data.size() < sizeof(T)) {
+            failed = true;
+            return {};
+        }
+        std::uint64_t bits = 0;
+        for (std::size_t i = sizeof(T); i-- > 0;) {
+            bits = bits << 8 | static_cast<unsigned char>(data[i]);
+        }
+        data.remove_prefix(sizeof(T));
+        return std::bit_cast<T>(static_cast<Bits<T>>(bits));
+    }
+};
+
+// Counts of components, characters and positions are 16 bits
+bool fits(std::size_t count) {
+    return count <= std::numeric_limits<std::uint16_t>::max();
+}
+
+// Reserves the header of a frame and returns its position
+std::size_t open_frame(std::string& out) {
+    const auto start = out.size();
+    out.append(Frame::header, '\0');
+    return start;
+}
+
+void close_frame(std::string& out, std::size_t start) {
+    std::string length;
+    put(length, static_cast<std::uint32_t>(out.size() - start - Frame::header));
+    out.replace(start, Frame::header, length);
+}
+
+void put_components(std::string& out, const std::vector<Component>& components) {
+    put(out, static_cast<std::uint16_t>(components.size()));
+    for (const auto& component : components) {
+        put(out, static_cast<std::uint8_t>(component.type));
+        put(out, component.ratio);
+        put(out, component.strike);
+        put(out, static_cast<std::int16_t>(component.expiration.tm_year));
+        put(out, static_cast<std::uint8_t>(component.expiration.tm_mon));
+        put(out, static_cast<std::uint8_t>(component.expiration.tm_mday));
+    }
+}
+
+std::vector<Component> get_components(Reader& reader) {
+    std::vector<Component> components(reader.get<std::uint16_t>());
+    for (auto& component : components) {
+        component.type               = static_cast<InstrumentType>(reader.get<std::uint8_t>());
+        component.ratio              = reader.get<double>();
+        component.strike             = reader.get<double>();
+        component.expiration.tm_year = reader.get<std::int16_t>();
+        component.expiration.tm_mon  = reader.get<std::uint8_t>();
+        component.expiration.tm_mday = reader.get<std::uint8_t>();
+        if (reader.failed) {
+            break;
+        }
+    }
+    return components;
+}
+
+void put_string(std::string& out, std::string_view value) {
+    put(out, static_cast<std::uint16_t>(value.size()));
+    out += value;
+}
+
+std::string get_string(Reader& reader) {
+    const auto length = reader.get<std::uint16_t>();
+    if (reader.failed || reader.data.size() < length) {
+        reader.failed = true;
+        return {};
+    }
+    std::string value(reader.data.substr(0, length));
+    reader.data.remove_prefix(length);
+    return value;
+}
+
+}  // anonymous namespace
+
+std::optional<std::size_t> Frame::length(std::string_view data) {
+    Reader reader{data};
+    const auto length = reader.get<std::uint32_t>();
+    if (reader.failed) {
+        return std::nullopt;
+    }
+    return header + length;
+}
+
+std::vector<std::string_view> Frame::messages(std::string_view data) {
+    std::vector<std::string_view> result;
+    for (auto size = length(data); size && *size <= data.size(); size = length(data)) {
+        result.push_back(data.substr(header, *size - header));
+        data.remove_prefix(*size);
+    }
+    return result;
+}
+
+bool Request::encode(std::string& out) const {
+    if (!fits(components.size())) {
+        return false;
+    }
+    const auto start = open_frame(out);
+    put(out, id);
+    put_components(out, components);
+    close_frame(out, start);
+    return true;
+}
+
+std::optional<Request> Request::decode(std::string_view message) {
+    Reader reader{message};
+    Request request;
+    request.id         = reader.get<std::uint64_t>();
+    request.components = get_components(reader);
+    if (reader.failed || !reader.data.empty()) {
+        return std::nullopt;
+    }
+    return request;
+}
+
+bool Response::encode(std::string& out) const {
+    if (!fits(name.size()) || !fits(order.size()) ||
+        std::any_of(order.begin(), order.end(), [](int position) { return position < 0 || !fits(position); })) {
+        return false;
+    }
+    const auto start = open_frame(out);
+    put(out, id);
+    put_string(out, name);
+    put(out, static_cast<std::uint16_t>(order.size()));
+    for (const auto position : order) {
+        put(out, static_cast<std::uint16_t>(position));
+    }
+    put(out, static_cast<std::uint8_t>(status));
+    close_frame(out, start);
+    return true;
+}
+
+std::optional<Response> Response::decode(std::string_view message) {
+    Reader reader{message};
+    Response response;
+    response.id   = reader.get<std::uint64_t>();
+    response.name = get_string(reader);
+    response.order.resize(reader.get<std::uint16_t>());
+    for (auto& position : response.order) {
+        position = reader.get<std::uint16_t>();
+    }
+    const auto status = reader.get<std::uint8_t>();
+    if (reader.failed || !reader.data.empty() ||
+        status > static_cast<std::uint8_t>(Classification::Status::BudgetExceeded)) {
+        return std::nullopt;
+    }
+    response.status = static_cast<Classification::Status>(status);
+    return response;
+}
+
+bool Slow::encode(std::string& out) const {
+    if (!fits(components.size()) || !fits(name.size())) {
+        return false;
+    }
+    const auto start = open_frame(out);
+    put_components(out, components);
+    put_string(out, name);
+    put(out, nanoseconds);
+    close_frame(out, start);
+    return true;
+}
+
+std::optional<Slow> Slow::decode(std::string_view message) {
+    Reader reader{message};
+    Slow slow;
+    slow.components  = get_components(reader);
+    slow.name        = get_string(reader);
+    slow.nanoseconds = reader.get<std::uint64_t>();
+    if (reader.failed || !reader.data.empty()) {
+        return std::nullopt;
+    }
+    return slow;
+}
+
+bool Captured::encode(std::string& out) const {
+    if (!fits(components.size())) {
+        return false;
+    }
+    const auto start = open_frame(out);
+    put(out, microseconds);
+    put_components(out, components);
+    close_frame(out, start);
+    return true;
+}
+
+std::optional<Captured> Captured::decode(std::string_view message) {
+    Reader reader{message};
+    Captured captured;
+    captured.microseconds = reader.get<std::uint64_t>();
+    captured.components   = get_components(reader);
+    if (reader.failed || !reader.data.empty()) {
+        return std::nullopt;
+    }
+    return captured;
+}
@@ -0,0 +1,37 @@
+#include "combinations/Signature.hpp"
+
+#include <numeric>
+
+void Signature::add(InstrumentType type) {
+    ++counts[index(type)];
+    ++total;
+}
+void Signature::remove(InstrumentType type) {
+    --counts[index(type)];
+    --total;
+}
+
+Signature Signature::times(std::size_t factor) const {
+    Signature result;
+    for (std::size_t i = 0; i < types; ++i) {
+        result.counts[i] = counts[i] * factor;
+    }
+    result.total = total * factor;
+    return result;
+}
+
+Signature Signature::reduced() const {
+    std::size_t divisor = 0;
+    for (const auto count : counts) {
+        divisor = std::gcd(divisor, count);
+    }
+    if (divisor <= 1) {
+        return *this;
+    }
+    Signature result;
+    for (std::size_t i = 0; i < types; ++i) {
+        result.counts[i] = counts[i] / divisor;
+    }
+    result.total = total / divisor;
+    return result;
+}
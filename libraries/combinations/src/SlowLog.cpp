@@ -0,0 +1,63 @@
+#include "combinations/SlowLog.hpp"
+
+#include "combinations/Protocol.hpp"
+
+std::unique_ptr<SlowLog> SlowLog::open(const std::filesystem::path& path, std::chrono::nanoseconds threshold) {
+    std::ofstream file(path, std::ios::binary | std::ios::app);
+    if (!file) {
+        return nullptr;
+    }
+    return std::unique_ptr<SlowLog>(new SlowLog(std::move(file), threshold));
+}
+
+SlowLog::SlowLog(std::ofstream file, std::chrono::nanoseconds threshold)
+    : threshold(threshold), file(std::move(file)), writer([this] { write(); }) {}
+
+SlowLog::~SlowLog() {
+    {
+        std::lock_guard lock(mutex);
+        closing = true;
+    }
+    queued.notify_one();
+    writer.join();
+}
+
+void SlowLog::add(const std::vector<Component>& components, const std::string& name,
+                  std::chrono::nanoseconds elapsed) {
+    std::string record;
+    const bool encoded = Slow{components, name, static_cast<std::uint64_t>(elapsed.count())}.encode(record);
+    {
+        std::lock_guard lock(mutex);
+        if (!encoded || records.size() >= max_queued) {
+            ++lost;
+            return;
+        }
+        records.push_back(std::move(record));
+    }
+    queued.notify_one();
+}
+
+std::size_t SlowLog::dropped() const {
+    std::lock_guard lock(mutex);
+    return lost;
+}
+
+// Takes the whole queue at once and writes it unlocked
+void SlowLog::write() {
+    std::vector<std::string> batch;
+    std::unique_lock lock(mutex);
+    while (true) {
+        queued.wait(lock, [this] { return closing || !records.empty(); });
+        if (records.empty()) {
+            return;
+        }
+        batch.swap(records);
+        lock.unlock();
+        for (const auto& record : batch) {
+            file.write(record.data(), static_cast<std::streamsize>(record.size()));
+        }
+        file.flush();
+        batch.clear();
+        lock.lock();
+    }
+}
@@ -0,0 +1,76 @@
+#include "combinations/Stream.hpp"
+
+Stream::Stream(const Combinations& combinations, Clock::duration timeout, std::size_t capacity, std::size_t backlog)
+    : combinations(combinations), timeout(timeout), capacity(capacity), backlog(backlog) {}
+
+void Stream::push(std::uint64_t id, std::size_t expected, const Component& component, Clock::time_point time) {
+    auto [found, added] = groups.emplace(id, first + queue.size());
+    if (added) {
+        auto& group     = queue.emplace_back();
+        group.expected  = expected;
+        group.time      = time;
+        group.result.id = id;
+    }
+    auto& group = queue[found->second - first];
+    group.result.components.push_back(component);
+    if (group.result.components.size() >= group.expected) {
+        close(group, Result::Status::Complete);
+    }
+    while (groups.size() > capacity) {
+        evict();
+    }
+    while (queue.size() > backlog) {
+        if (!queue.front().closed) {
+            close(queue.front(), Result::Status::Evicted);
+        }
+        next();
+        ++lost;
+    }
+}
+
+void Stream::expire(Clock::time_point time) {
+    for (; oldest < first + queue.size(); ++oldest) {
+        auto& group = queue[oldest - first];
+        if (!group.closed) {
+            if (time - group.time < timeout) {
+                break;
+            }
+            close(group, Result::Status::Timeout);
+        }
+    }
+}
+
+void Stream::flush() {
+    for (; oldest < first + queue.size(); ++oldest) {
+        if (!queue[oldest - first].closed) {
+            close(queue[oldest - first], Result::Status::Timeout);
+        }
+    }
+}
+
+std::optional<Stream::Result> Stream::next() {
+    if (queue.empty() || !queue.front().closed) {
+        return std::nullopt;
+    }
+    auto result = std::move(queue.front().result);
+    queue.pop_front();
+    ++first;
+    if (oldest < first) {
+        oldest = first;
+    }
+    return result;
+}
+
+void Stream::close(Group& group, Result::Status status) {
+    group.closed        = true;
+    group.result.status = status;
+    group.result.name   = combinations.classify(group.result.components, group.result.order);
+    groups.erase(group.result.id);
+}
+
+void Stream::evict() {
+    while (queue[oldest - first].closed) {
+        ++oldest;
+    }
+    close(queue[oldest - first], Result::Status::Evicted);
+}
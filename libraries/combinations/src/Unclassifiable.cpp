@@ -0,0 +1,34 @@
+#include "combinations/Unclassifiable.hpp"
+
+#include "combinations/Input.hpp"
+
+Unclassifiable::Unclassifiable() : filter(new std::atomic<std::uint64_t>[bits / 64]()) {}
+
+bool Unclassifiable::contains(const Key& key) const {
+    // Bits of the key by double hashing, the second hash odd
+    const auto h = Input::hash(key), step = (h >> 32) | 1;
+    for (std::size_t i = 0; i < hashes; ++i) {
+        const auto bit = (h + i * step) % bits;
+        if ((filter[bit / 64].load(std::memory_order_relaxed) & (std::uint64_t{1} << bit % 64)) == 0) {
+            return false;
+        }
+    }
+    std::lock_guard lock(mutex);
+    return keys.contains(key);
+}
+
+void Unclassifiable::add(Key key) {
+    const auto h = Input::hash(key), step = (h >> 32) | 1;
+    std::lock_guard lock(mutex);
+    if (keys.size() >= capacity) {
+        keys.clear();
+        for (std::size_t i = 0; i < bits / 64; ++i) {
+            filter[i].store(0, std::memory_order_relaxed);
+        }
+    }
+    keys.insert(std::move(key));
+    for (std::size_t i = 0; i < hashes; ++i) {
+        const auto bit = (h + i * step) % bits;
+        filter[bit / 64].fetch_or(std::uint64_t{1} << bit % 64, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,37 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+#include "combinations/Combinations.hpp"
+#include "fuzz.hpp"
+
+// libFuzzer target of classify against the built-in catalogue. An input over the budget or with a wrong order aborts,
+// libFuzzer saves it as a crash; an input stuck outside the budget is saved as a timeout by its -timeout option. Run
+// from this directory as
+//     fuzz -artifact_prefix=corpus/ -timeout=5 -max_len=1024 corpus
+// so the inputs found land in the corpus the tests replay
+
+namespace {
+
+Combinations combinations;
+
+}  // anonymous namespace
+
+extern "C" int LLVMFuzzerInitialize(int *, char ***) {
+    if (!combinations.load_builtin()) {
+        std::cerr << "Failed to load the built-in catalogue" << std::endl;
+        std::abort();
+    }
+    return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size) {
+    const auto failure = fuzz_failure(combinations, std::string_view(reinterpret_cast<const char *>(data), size));
+    if (!failure.empty()) {
+        std::cerr << failure << std::endl;
+        std::abort();
+    }
+    return 0;
+}
@@ -1,6 +1,20 @@
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <set>
+
+#include "combinations/Adaptive.hpp"
+#include "combinations/Cache.hpp"
+#include "combinations/Catalogue.hpp"
 #include "combinations/Combinations.hpp"
 #include "combinations/Component.hpp"
+#include "combinations/Input.hpp"
+#include "combinations/Protocol.hpp"
+#include "combinations/Stream.hpp"
+#include "combinations/Unclassifiable.hpp"
+#include "fuzz.hpp"
 #include "gtest/gtest.h"
+#include "instances.hpp"
 
 namespace {
 
@@ -32,6 +46,387 @@ TEST(CombinationsResourceTest, resource_does_not_exist) {
     ASSERT_FALSE(combinations.load(path));
 }
 
+TEST(CombinationsResourceTest, buffer) {
+    Combinations combinations;
+    ASSERT_FALSE(combinations.load(std::span<const char>()));
+    const std::string resource = R"(<combinations>
+    <combination name="Future spread" shortname="S" identifier="1">
+        <legs cardinality="fixed">
+            <leg type="F" ratio="1" expiration="a"/>
+            <leg type="F" ratio="-1" expiration="a"/>
+        </legs>
+    </combination>
+</combinations>)";
+    ASSERT_TRUE(combinations.load(std::span<const char>(resource)));
+
+    const std::vector<Component> components = {
+        Component::from_string("F -1 2010-03-01"),
+        Component::from_string("F 1 2010-03-01"),
+    };
+    std::vector<int> order;
+    ASSERT_EQ("Future spread", combinations.classify(components, order));
+    ASSERT_EQ((std::vector<int>{2, 1}), order);
+}
+
+TEST(CombinationsResourceTest, fractional_ratio) {
+    Combinations combinations;
+    const std::string resource = R"(<combinations>
+    <combination name="Ratio spread" shortname="R" identifier="1">
+        <legs cardinality="fixed">
+            <leg type="F" ratio="0.1" expiration="a"/>
+            <leg type="F" ratio="-0.35" expiration="b"/>
+        </legs>
+    </combination>
+</combinations>)";
+    ASSERT_TRUE(combinations.load(std::span<const char>(resource)));
+
+    std::vector<int> order;
+    ASSERT_EQ("Ratio spread", combinations.classify({Component::from_string("F -0.35 2010-04-01"),
+                                                     Component::from_string("F 0.1 2010-03-01")},
+                                                    order));
+    ASSERT_EQ((std::vector<int>{2, 1}), order);
+    ASSERT_EQ("Unclassified", combinations.classify({Component::from_string("F -0.3 2010-04-01"),
+                                                     Component::from_string("F 0.1 2010-03-01")},
+                                                    order));
+}
+
+TEST(CombinationsResourceTest, tolerance) {
+    Combinations combinations;
+    const std::string resource = R"(<combinations>
+    <combination name="Ratio spread" shortname="R" identifier="1">
+        <legs cardinality="fixed">
+            <leg type="F" ratio="0.3" expiration="a"/>
+            <leg type="F" ratio="-0.3" expiration="b"/>
+        </legs>
+    </combination>
+    <combination name="Straddle" shortname="S" identifier="2">
+        <legs cardinality="fixed">
+            <leg type="C" ratio="1" strike="a" expiration="a"/>
+            <leg type="P" ratio="1" strike="a" expiration="a"/>
+        </legs>
+    </combination>
+</combinations>)";
+    ASSERT_TRUE(combinations.load(std::span<const char>(resource)));
+
+    std::vector<Component> spread = {
+        Component::from_string("F 1 2010-03-01"),
+        Component::from_string("F 1 2010-04-01"),
+    };
+    spread[0].ratio = 0.1 + 0.2;
+    spread[1].ratio = -0.3;
+
+    const std::vector<Component> straddle = {
+        Component::from_string("C 1 2100 2010-03-01"),
+        Component::from_string("P 1 2100.02 2010-03-01"),
+    };
+    std::vector<int> order;
+    ASSERT_EQ("Ratio spread", combinations.classify(spread, order));
+    ASSERT_EQ("Unclassified", combinations.classify(straddle, order));
+    spread[1].ratio = -0.3004;
+    ASSERT_EQ("Unclassified", combinations.classify(spread, order));
+
+    combinations.set_tolerance({0.001, 0.05});
+    ASSERT_EQ("Ratio spread", combinations.classify(spread, order));
+    ASSERT_EQ("Straddle", combinations.classify(straddle, order));
+}
+
+TEST(CombinationsResourceTest, scaled_ratios) {
+    Combinations combinations;
+    const std::string resource = R"(<combinations>
+    <combination name="Butterfly" shortname="B" identifier="1">
+        <legs cardinality="fixed">
+            <leg type="C" ratio="1" strike_offset="-" expiration="a"/>
+            <leg type="C" ratio="-2" strike_offset="" expiration="a"/>
+            <leg type="C" ratio="1" strike_offset="+" expiration="a"/>
+        </legs>
+    </combination>
+    <combination name="Double spread" shortname="D" identifier="2">
+        <legs cardinality="fixed">
+            <leg type="F" ratio="2" expiration="a"/>
+            <leg type="F" ratio="-2" expiration="b"/>
+        </legs>
+    </combination>
+</combinations>)";
+    ASSERT_TRUE(combinations.load(std::span<const char>(resource)));
+
+    const std::vector<Component> butterfly = {
+        Component::from_string("C -4 2100 2010-03-01"),
+        Component::from_string("C 2 2200 2010-03-01"),
+        Component::from_string("C 2 2000 2010-03-01"),
+    };
+    std::vector<Component> spread = {
+        Component::from_string("F 0.5 2010-03-01"),
+        Component::from_string("F -0.5 2010-04-01"),
+    };
+    std::vector<int> order;
+    Budget budget;
+    ASSERT_EQ("Unclassified", combinations.classify(butterfly, order));
+    ASSERT_EQ("Unclassified", combinations.classify(spread, order));
+    ASSERT_EQ(1, combinations.classify(butterfly, order, budget).scale);
+
+    Tolerance tolerance;
+    tolerance.scaled = true;
+    combinations.set_tolerance(tolerance);
+    auto result = combinations.classify(butterfly, order, budget);
+    ASSERT_EQ("Butterfly", result.name);
+    ASSERT_EQ(2, result.scale);
+    ASSERT_EQ((std::vector<int>{2, 3, 1}), order);
+    result = combinations.classify(spread, order, budget);
+    ASSERT_EQ("Double spread", result.name);
+    ASSERT_EQ(0.25, result.scale);
+    spread[1].ratio = -1;
+    ASSERT_EQ("Unclassified", combinations.classify(spread, order));
+    spread[0].ratio = 2e300;  // both saturate, they are not scaled to 1 and -1
+    spread[1].ratio = -4e300;
+    ASSERT_EQ("Unclassified", combinations.classify(spread, order));
+}
+
+TEST(CombinationsResourceTest, shadowed_types) {
+    Combinations combinations;
+    const std::string resource = R"(<combinations>
+    <combination name="Calendar" shortname="C" identifier="1">
+        <legs cardinality="fixed">
+            <leg type="F" ratio="1" expiration="a"/>
+            <leg type="F" ratio="-1" expiration="b"/>
+        </legs>
+    </combination>
+    <combination name="Same day" shortname="S" identifier="2">
+        <legs cardinality="fixed">
+            <leg type="F" ratio="1" expiration="X"/>
+            <leg type="F" ratio="-1" expiration="X"/>
+        </legs>
+    </combination>
+    <combination name="Long strip" shortname="L" identifier="3">
+        <legs cardinality="more" mincount="2">
+            <leg type="F" ratio="+"/>
+        </legs>
+    </combination>
+    <combination name="Long pair" shortname="P" identifier="4">
+        <legs cardinality="fixed">
+            <leg type="F" ratio="1" expiration="a"/>
+            <leg type="F" ratio="2" expiration_offset="+"/>
+        </legs>
+    </combination>
+    <combination name="Calendar copy" shortname="CC" identifier="5">
+        <legs cardinality="fixed">
+            <leg type="F" ratio="1" expiration="a"/>
+            <leg type="F" ratio="-1" expiration="b"/>
+        </legs>
+    </combination>
+</combinations>)";
+    ASSERT_TRUE(combinations.load(std::span<const char>(resource)));
+
+    const auto shadowed = combinations.shadowed();
+    ASSERT_EQ(3u, shadowed.size());
+    EXPECT_EQ("Same day", shadowed[0].name);
+    EXPECT_EQ("Calendar", shadowed[0].by);
+    EXPECT_EQ("Long pair", shadowed[1].name);
+    EXPECT_EQ("Long strip", shadowed[1].by);
+    EXPECT_EQ("Calendar copy", shadowed[2].name);
+    EXPECT_EQ("Calendar", shadowed[2].by);
+    EXPECT_TRUE(combinations.exclusive("Calendar", "Long strip"));
+    EXPECT_FALSE(combinations.exclusive("Calendar", "Same day"));
+
+    // Shadowed types are skipped by classify but still match
+    const std::vector<Component> same_day = {
+        Component::from_string("F -1 2010-03-01"),
+        Component::from_string("F 1 2010-03-01"),
+    };
+    std::vector<int> order;
+    ASSERT_EQ("Calendar", combinations.classify(same_day, order));
+    const auto matches = combinations.classify_all(same_day);
+    ASSERT_EQ(3u, matches.size());
+    EXPECT_EQ("Same day", matches[1].name);
+}
+
+TEST(CombinationsResourceTest, unclassified_filter) {
+    Combinations combinations;
+    const std::string calendar = R"(<combinations>
+    <combination name="Calendar" shortname="C" identifier="1">
+        <legs cardinality="fixed">
+            <leg type="F" ratio="1" expiration="a"/>
+            <leg type="F" ratio="-1" expiration="b"/>
+        </legs>
+    </combination>
+</combinations>)";
+    ASSERT_TRUE(combinations.load(std::span<const char>(calendar)));
+    combinations.set_unclassified_filter(true);
+
+    const std::vector<Component> double_spread = {
+        Component::from_string("F 2 2010-03-01"),
+        Component::from_string("F -2 2010-04-01"),
+    };
+    const std::vector<Component> reversed = {double_spread[1], double_spread[0]};
+    std::vector<int> order;
+    Budget budget;
+    ASSERT_EQ(1u, combinations.classify(double_spread, order, budget).evaluated);
+    const auto result = combinations.classify(reversed, order, budget);
+    EXPECT_EQ("Unclassified", result.name);
+    EXPECT_EQ(0u, result.evaluated);
+
+    // Inputs close to a known one are still checked, beyond the capacity the filter starts over
+    for (int i = 3; i < 2 * static_cast<int>(Unclassifiable::capacity); ++i) {
+        const std::vector<Component> other = {
+            Component::from_string("F " + std::to_string(i) + " 2010-03-01"),
+            Component::from_string("F -" + std::to_string(i) + " 2010-04-01"),
+        };
+        ASSERT_EQ(1u, combinations.classify(other, order, budget).evaluated) << i;
+    }
+    const std::vector<Component> spread = {
+        Component::from_string("F -1 2010-04-01"),
+        Component::from_string("F 1 2010-03-01"),
+    };
+    EXPECT_EQ("Calendar", combinations.classify(spread, order));
+
+    // Types loaded later may match what was unclassified
+    combinations.classify(double_spread, order);
+    const std::string double_calendar = R"(<combinations>
+    <combination name="Double calendar" shortname="D" identifier="2">
+        <legs cardinality="fixed">
+            <leg type="F" ratio="2" expiration="a"/>
+            <leg type="F" ratio="-2" expiration="b"/>
+        </legs>
+    </combination>
+</combinations>)";
+    ASSERT_TRUE(combinations.load(std::span<const char>(double_calendar)));
+    EXPECT_EQ("Double calendar", combinations.classify(reversed, order));
+}
+
+TEST(CombinationsResourceTest, persistent_cache) {
+    const std::string calendar = R"(<combinations>
+    <combination name="Calendar" shortname="C" identifier="1">
+        <legs cardinality="fixed">
+            <leg type="F" ratio="1" expiration="a"/>
+            <leg type="F" ratio="-1" expiration="b"/>
+        </legs>
+    </combination>
+</combinations>)";
+    const auto path = std::filesystem::temp_directory_path() / "combinations_test_cache";
+    std::filesystem::remove(path);
+
+    const std::vector<Component> spread = {
+        Component::from_string("F 1 2010-03-01"),
+        Component::from_string("F -1 2010-04-01"),
+    };
+    const std::vector<Component> reversed = {spread[1], spread[0]};
+    const std::vector<Component> strip    = {spread[0], Component::from_string("F 1 2010-04-01")};
+    std::vector<int> order;
+    Budget budget;
+    {
+        Combinations first;
+        ASSERT_TRUE(first.load(std::span<const char>(calendar)));
+        ASSERT_TRUE(first.open_cache(path));
+        EXPECT_FALSE(first.classify(spread, order, budget).cached);
+        EXPECT_FALSE(first.classify(strip, order, budget).cached);
+        EXPECT_TRUE(first.classify(strip, order, budget).cached);
+    }
+
+    // A later run serves the same components in any order
+    Combinations other;
+    ASSERT_TRUE(other.load(std::filesystem::path{"test/etc/combinations.xml"}));
+    {
+        Combinations second;
+        ASSERT_TRUE(second.load(std::span<const char>(calendar)));
+        ASSERT_TRUE(second.open_cache(path));
+        const auto result = second.classify(reversed, order, budget);
+        EXPECT_TRUE(result.cached);
+        EXPECT_EQ("Calendar", result.name);
+        EXPECT_EQ(std::vector<int>({2, 1}), order);
+        EXPECT_EQ("Unclassified", second.classify(strip, order, budget).name);
+        EXPECT_FALSE(other.open_cache(path));  // locked while open
+
+        // Another tolerance finds the cache empty
+        second.set_tolerance({.ratio = 0.1});
+        EXPECT_FALSE(second.classify(spread, order, budget).cached);
+    }
+
+    // So do other types
+    ASSERT_TRUE(other.open_cache(path));
+    EXPECT_FALSE(other.classify(reversed, order, budget).cached);
+    std::filesystem::remove(path);
+}
+
+// A type past those of the catalogue is not served, a damaged file may hold one
+TEST(CombinationsResourceTest, cache_type_range) {
+    const auto path = std::filesystem::temp_directory_path() / "combinations_test_cache_type_range";
+    std::filesystem::remove(path);
+    const std::vector<std::int64_t> key = {1, 0, 1, 0, 0};
+    {
+        const auto cache = Cache::open(path, 1, 2);
+        ASSERT_NE(nullptr, cache);
+        cache->add(key, {2, {1}});
+        EXPECT_FALSE(cache->find(key).has_value());
+    }
+    const auto cache = Cache::open(path, 1, 3);
+    ASSERT_NE(nullptr, cache);
+    const auto found = cache->find(key);
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(2u, found->type);
+    std::filesystem::remove(path);
+}
+
+// A cache hit returns the order classify finds without the cache, not the one of the components it was kept for
+TEST(CombinationsResourceTest, cached_order) {
+    const auto path = std::filesystem::temp_directory_path() / "combinations_test_cached_order";
+    std::filesystem::remove(path);
+    Combinations uncached, cached;
+    ASSERT_TRUE(uncached.load(std::filesystem::path{"test/etc/combinations.xml"}));
+    ASSERT_TRUE(cached.load(std::filesystem::path{"test/etc/combinations.xml"}));
+    ASSERT_TRUE(cached.open_cache(path));
+
+    const std::vector<Component> strip = {
+        Component::from_string("F 2 2010-03-01"),
+        Component::from_string("F 2 2010-05-01"),
+    };
+    const std::vector<Component> reversed = {strip[1], strip[0]};
+    std::vector<int> order, expected;
+    Budget budget;
+    ASSERT_EQ("Strip", uncached.classify(reversed, expected));
+    EXPECT_FALSE(cached.classify(strip, order, budget).cached);
+    const auto result = cached.classify(reversed, order, budget);
+    EXPECT_TRUE(result.cached);
+    EXPECT_EQ("Strip", result.name);
+    EXPECT_EQ(expected, order);
+    std::filesystem::remove(path);
+}
+
+TEST(CombinationsResourceTest, many_types) {
+    // Enough types for load to parse them on several threads, they have to keep their priority
+    const std::size_t pairs = 2000;
+    std::string resource    = "<combinations>\n";
+    for (std::size_t i = 0; i < pairs; ++i) {
+        resource += R"(<combination name="Spread )" + std::to_string(i) + R"(">
+    <legs cardinality="fixed">
+        <leg type="F" ratio="1" expiration="a"/>
+        <leg type="F" ratio="-1" expiration="b"/>
+    </legs>
+</combination>
+<combination name="Strip )" + std::to_string(i) + R"(">
+    <legs cardinality="more" mincount="3">
+        <leg type="F" ratio="+"/>
+    </legs>
+</combination>
+)";
+    }
+    resource += "</combinations>\n";
+    Combinations combinations;
+    ASSERT_TRUE(combinations.load(std::span<const char>(resource)));
+
+    const std::vector<Component> spread = {
+        Component::from_string("F 1 2010-03-01"),
+        Component::from_string("F -1 2010-04-01"),
+    };
+    const auto matches = combinations.classify_all(spread);
+    ASSERT_EQ(pairs, matches.size());
+    for (std::size_t i = 0; i < pairs; ++i) {
+        ASSERT_EQ("Spread " + std::to_string(i), matches[i].name);
+    }
+
+    const std::vector<Component> strip{3, Component::from_string("F 1 2010-03-01")};
+    std::vector<int> order;
+    ASSERT_EQ("Strip 0", combinations.classify(strip, order));
+}
+
 TEST(CombinationsResourceTest, empty_resource) {
     const std::filesystem::path path{"test/etc/empty.xml"};
     std::error_code ec;
@@ -183,6 +578,595 @@ TEST_F(CombinationsTest, much_more_fail) {
     ASSERT_TRUE(order.empty());
 }
 
+TEST_F(CombinationsTest, strategy) {
+    ASSERT_EQ(Strategy::Permutation, combinations().strategy("Inter commodity spread", 2));
+    ASSERT_EQ(Strategy::Backtracking, combinations().strategy("Pack", 4));
+    ASSERT_EQ(Strategy::Backtracking, combinations().strategy("Bundle", 8));
+    ASSERT_EQ(Strategy::Chain, combinations().strategy("Call ladder", 3));
+    ASSERT_EQ(Strategy::Linear, combinations().strategy("Strip", 6));
+    ASSERT_FALSE(combinations().strategy("Unknown", 2).has_value());
+}
+
+TEST_F(CombinationsTest, backtracking_equal_legs) {
+    const std::vector<Component> components{12, Component::from_string("F 1 2010-03-01")};
+    std::vector<int> order;
+    ASSERT_EQ("Strip", combinations().classify(components, order));  // not "Bundle"
+    ASSERT_EQ(components.size(), order.size());
+    ASSERT_TRUE(check_order_basic(order));
+}
+
+TEST_F(CombinationsTest, budget_exceeded) {
+    const std::vector<Component> components = {
+        Component::from_string("F 1 2010-03-01"), Component::from_string("F 1 2010-06-01"),
+        Component::from_string("F 1 2010-09-01"), Component::from_string("F 1 2010-12-01"),
+        Component::from_string("F 1 2010-03-02"), Component::from_string("F 1 2010-06-02"),
+        Component::from_string("F 1 2010-09-02"), Component::from_string("F 1 2010-12-02"),
+    };
+    std::vector<int> order;
+    Budget budget{std::chrono::seconds(10), 4};
+    const auto result = combinations().classify(components, order, budget);
+    ASSERT_EQ(Classification::Status::BudgetExceeded, result.status);
+    ASSERT_EQ("Budget exceeded", result.name);
+    ASSERT_EQ(0, result.evaluated);  // types not admitting eight futures are skipped, the first one that does runs out
+    ASSERT_TRUE(order.empty());
+}
+
+TEST_F(CombinationsTest, budget_enough) {
+    const std::vector<Component> components = {
+        Component::from_string("F 1 2010-03-01"), Component::from_string("F 1 2010-06-01"),
+        Component::from_string("F 1 2010-09-01"), Component::from_string("F 1 2010-12-01"),
+        Component::from_string("F 1 2010-03-02"), Component::from_string("F 1 2010-06-02"),
+        Component::from_string("F 1 2010-09-02"), Component::from_string("F 1 2010-12-02"),
+    };
+    std::vector<int> order;
+    Budget budget{std::chrono::seconds(10), 1000};
+    const auto result = combinations().classify(components, order, budget);
+    ASSERT_EQ(Classification::Status::Classified, result.status);
+    ASSERT_EQ("Bundle", result.name);
+    ASSERT_EQ(components.size(), order.size());
+    ASSERT_TRUE(check_order_basic(order));
+}
+
+TEST_F(CombinationsTest, budget_deadline) {
+    const std::vector<Component> components{12, Component::from_string("F 1 2010-03-01")};
+    std::vector<int> order;
+    Budget budget{std::chrono::seconds(-1)};
+    const auto result = combinations().classify(components, order, budget);
+    ASSERT_EQ(Classification::Status::BudgetExceeded, result.status);
+    ASSERT_TRUE(order.empty());
+}
+
+TEST_F(CombinationsTest, classify_all) {
+    const std::vector<Component> components = {
+        Component::from_string("F 1 2010-09-01"),
+        Component::from_string("F 1 2010-03-01"),
+        Component::from_string("F 1 2010-12-01"),
+        Component::from_string("F 1 2010-06-01"),
+    };
+    const auto matches = combinations().classify_all(components);
+    ASSERT_EQ(3u, matches.size());
+    ASSERT_EQ("Pack", matches[0].name);
+    ASSERT_EQ("Bundle", matches[1].name);
+    ASSERT_EQ("Strip", matches[2].name);
+    ASSERT_EQ((std::vector<int>{3, 1, 4, 2}), matches[0].order);
+    for (const auto& match : matches) {
+        ASSERT_EQ(components.size(), match.order.size());
+        ASSERT_TRUE(check_order_basic(match.order));
+    }
+
+    std::vector<int> order;
+    ASSERT_EQ(matches[0].name, combinations().classify(components, order));
+    ASSERT_EQ(matches[0].order, order);
+}
+
+TEST_F(CombinationsTest, classify_all_unclassified) {
+    const std::vector<Component> components = {
+        Component::from_string("P 1 2000 2010-03-01"),
+        Component::from_string("P 1 2000 2010-03-02"),
+    };
+    ASSERT_TRUE(combinations().classify_all(components).empty());
+}
+
+TEST_F(CombinationsTest, matches_lazy) {
+    const std::vector<Component> components = {
+        Component::from_string("F 1 2010-03-01"),
+        Component::from_string("F 1 2010-06-01"),
+        Component::from_string("F 1 2010-09-01"),
+        Component::from_string("F 1 2010-12-01"),
+    };
+    auto matches     = combinations().matches(components);
+    const auto first = matches.next();
+    ASSERT_TRUE(first.has_value());
+    ASSERT_EQ("Pack", first->name);
+    ASSERT_EQ((std::vector<int>{1, 2, 3, 4}), first->order);
+    ASSERT_EQ("Bundle", matches.next()->name);
+    ASSERT_EQ("Strip", matches.next()->name);
+    ASSERT_FALSE(matches.next().has_value());
+    ASSERT_FALSE(matches.next().has_value());
+}
+
+TEST_F(CombinationsTest, orderings) {
+    const std::vector<Component> components = {
+        Component::from_string("F 1 2010-03-01"), Component::from_string("F 1 2010-06-01"),
+        Component::from_string("F 1 2010-09-01"), Component::from_string("F 1 2010-12-01"),
+        Component::from_string("F 1 2010-03-01"), Component::from_string("F 1 2010-06-01"),
+        Component::from_string("F 1 2010-09-01"), Component::from_string("F 1 2010-12-01"),
+    };
+    auto orderings = combinations().orderings("Bundle", components);
+    std::set<std::vector<int>> orders;
+    while (auto order = orderings.next()) {
+        ASSERT_EQ(components.size(), order->size());
+        ASSERT_TRUE(check_order_basic(*order));
+        for (int i = 0, end = order->size(); i < end; ++i) {
+            ASSERT_EQ(i % 4, ((*order)[i] - 1) % 4);
+        }
+        orders.insert(*order);
+    }
+    ASSERT_EQ(16u, orders.size());
+    ASSERT_EQ(16u, combinations().count_orderings("Bundle", components));
+    ASSERT_FALSE(orderings.next().has_value());
+}
+
+TEST_F(CombinationsTest, orderings_count) {
+    const std::vector<Component> strip{6, Component::from_string("F 10 2010-03-01")};
+    ASSERT_EQ(720u, combinations().count_orderings("Strip", strip));
+
+    const std::vector<Component> butterfly = {
+        Component::from_string("C -1 2200 2010-03-01"),
+        Component::from_string("C 1 2100 2010-03-01"),
+        Component::from_string("P 1 2100 2010-03-01"),
+        Component::from_string("P -1 2000 2010-03-01"),
+    };
+    ASSERT_EQ(1u, combinations().count_orderings("Iron butterfly", butterfly));
+    ASSERT_EQ(0u, combinations().count_orderings("Iron condor", butterfly));
+    ASSERT_EQ(0u, combinations().count_orderings("Unknown", butterfly));
+    ASSERT_FALSE(combinations().orderings("Unknown", butterfly).next().has_value());
+}
+
+TEST_F(CombinationsTest, chain_order) {
+    const std::vector<Component> components = {
+        Component::from_string("C -1 2200 2010-03-01"),
+        Component::from_string("C 1 2000 2010-03-01"),
+        Component::from_string("C -1 2100 2010-03-01"),
+    };
+    std::vector<int> order;
+    ASSERT_EQ("Call ladder", combinations().classify(components, order));
+    ASSERT_EQ((std::vector<int>{3, 1, 2}), order);
+}
+
+TEST_F(CombinationsTest, chain_equal_levels) {
+    const std::vector<Component> components = {
+        Component::from_string("C -1 2200 2010-03-01"),
+        Component::from_string("C 1 2100 2010-03-01"),
+        Component::from_string("P 1 2100 2010-03-01"),
+        Component::from_string("P -1 2000 2010-03-01"),
+    };
+    std::vector<int> order;
+    ASSERT_EQ("Iron butterfly", combinations().classify(components, order));
+    ASSERT_EQ((std::vector<int>{4, 3, 2, 1}), order);
+}
+
+TEST_F(CombinationsTest, chain_tie_fail) {
+    const std::vector<Component> components = {
+        Component::from_string("C -1 2100 2010-03-01"),
+        Component::from_string("C 1 2000 2010-03-01"),
+        Component::from_string("C -1 2100 2010-03-01"),
+    };
+    std::vector<int> order;
+    ASSERT_EQ("Unclassified", combinations().classify(components, order));  // not "Call ladder"
+    ASSERT_TRUE(order.empty());
+}
+
+// Strikes past max_strike ticks stay distinct and ordered, ratios past max_ratio keep their sign
+TEST_F(CombinationsTest, large_values) {
+    const std::vector<Component> guts = {
+        Component::from_string("C 1 10000000000000 2010-03-01"),
+        Component::from_string("P 1 20000000000000 2010-03-01"),
+    };
+    const std::vector<Component> spread = {
+        Component::from_string("C 1 10000000000000 2010-03-01"),
+        Component::from_string("C -1 20000000000000 2010-03-01"),
+    };
+    const std::vector<Component> strip = {
+        Component::from_string("F 1e308 2010-03-01"),
+        Component::from_string("F 1e308 2010-04-01"),
+    };
+    std::vector<int> order;
+    ASSERT_EQ("Guts", combinations().classify(guts, order));
+    ASSERT_EQ("Call spread", combinations().classify(spread, order));
+    ASSERT_EQ("Strip", combinations().classify(strip, order));
+
+    const Tolerance tolerance;
+    const auto limit = static_cast<double>(Tolerance::max_strike) * tolerance.strike;
+    ASSERT_LT(tolerance.strike_of(std::nextafter(limit, 0.0)), tolerance.strike_of(limit));
+    ASSERT_LT(tolerance.strike_of(limit), tolerance.strike_of(std::nextafter(limit, HUGE_VAL)));
+    ASSERT_LT(tolerance.strike_of(1e300), tolerance.strike_of(HUGE_VAL));
+    ASSERT_EQ(-tolerance.strike_of(1e13), tolerance.strike_of(-1e13));
+    ASSERT_EQ(Tolerance::max_ratio, Tolerance::ratio_of(1e308));
+    ASSERT_EQ(-Tolerance::max_ratio, Tolerance::ratio_of(-HUGE_VAL));
+    ASSERT_EQ(0, Tolerance::ratio_of(std::nan("")));
+
+    // Their sums saturate, the profiles leave those to the matchers
+    const std::vector<Component> calls(2048, Component::from_string("C 1e308 2100 2010-03-01"));
+    const Input input(calls, tolerance);
+    ASSERT_EQ(std::numeric_limits<std::int64_t>::max(), input.sums[Signature::index(InstrumentType::C)]);
+    ASSERT_EQ("Unclassified", combinations().classify(calls, order));
+}
+
+// A tiny ratio rounds to 0 ticks but keeps its sign for the legs matching by sign only
+TEST_F(CombinationsTest, tiny_ratios) {
+    const std::vector<Component> strip = {
+        Component::from_string("F 1e-7 2010-03-01"),
+        Component::from_string("F 1 2010-04-01"),
+    };
+    const std::vector<Component> zero = {
+        Component::from_string("F 0 2010-03-01"),
+        Component::from_string("F 1 2010-04-01"),
+    };
+    std::vector<int> order;
+    ASSERT_EQ("Strip", combinations().classify(strip, order));
+    ASSERT_EQ("Unclassified", combinations().classify(zero, order));
+
+    // Equal ticks of other signs are no twins
+    const std::vector<Component> signs = {zero[0], Component::from_string("F 1e-7 2010-03-01")};
+    const Input input(signs);
+    ASSERT_EQ((std::vector<int>{-1, -1}), input.twins);
+}
+
+TEST_F(CombinationsTest, decompose) {
+    const std::vector<Component> book = {
+        Component::from_string("P -1 2000 2010-03-01"),
+        Component::from_string("U 1 2010-03-01"),
+        Component::from_string("C 1 2100 2010-03-01"),
+        Component::from_string("P 1 2100 2010-03-01"),
+        Component::from_string("C -1 2200 2010-03-01"),
+    };
+    const auto decomposition = combinations().decompose(book);
+    ASSERT_EQ(2u, decomposition.parts.size());  // spreads come before "Iron butterfly"
+    ASSERT_EQ("Call spread", decomposition.parts[0].name);
+    ASSERT_EQ((std::vector<int>{2, 4}), decomposition.parts[0].components);
+    ASSERT_EQ("Put spread", decomposition.parts[1].name);
+    ASSERT_EQ((std::vector<int>{3, 0}), decomposition.parts[1].components);
+    ASSERT_EQ(std::vector<int>{1}, decomposition.leftover);
+
+    ASSERT_TRUE(combinations().decompose({}).parts.empty());
+}
+
+// Greedy takes the 2100 call as the top leg of the first butterfly, the repair moves it to the second one
+TEST_F(CombinationsTest, decompose_repair) {
+    const std::vector<Component> book = {
+        Component::from_string("C 1 2000 2010-03-01"), Component::from_string("C -2 2050 2010-03-01"),
+        Component::from_string("C 1 2100 2010-03-01"), Component::from_string("C -2 2150 2010-03-01"),
+        Component::from_string("C 1 2200 2010-03-01"), Component::from_string("C 1 2300 2010-03-01"),
+    };
+    const auto decomposition = combinations().decompose(book);
+    ASSERT_EQ(2u, decomposition.parts.size());
+    ASSERT_EQ("Call butterfly", decomposition.parts[0].name);
+    ASSERT_EQ((std::vector<int>{0, 1, 5}), decomposition.parts[0].components);
+    ASSERT_EQ("Call butterfly", decomposition.parts[1].name);
+    ASSERT_EQ((std::vector<int>{2, 3, 4}), decomposition.parts[1].components);
+    ASSERT_TRUE(decomposition.leftover.empty());
+}
+
+TEST_F(CombinationsTest, session) {
+    auto session = combinations().session();
+    std::vector<int> order;
+    ASSERT_EQ("Unclassified", session.current(order));
+
+    ASSERT_EQ(0u, session.add(Component::from_string("C 1 2100 2010-03-01")));
+    ASSERT_EQ(1u, session.add(Component::from_string("C -1 2200 2010-03-01")));
+    ASSERT_EQ("Call spread", session.current(order));
+    ASSERT_EQ((std::vector<int>{1, 2}), order);
+
+    session.add(Component::from_string("P 1 2100 2010-03-01"));
+    session.add(Component::from_string("P -1 2000 2010-03-01"));
+    ASSERT_EQ("Iron butterfly", session.current(order));
+
+    session.modify(3, Component::from_string("P -1 1900 2010-03-01"));
+    ASSERT_EQ(combinations().classify(session.components(), order), session.current(order));
+
+    session.remove(3);
+    session.remove(2);
+    ASSERT_EQ("Call spread", session.current(order));
+    session.modify(0, Component::from_string("F 1 2010-03-01"));
+    ASSERT_EQ("Unclassified", session.current(order));
+    ASSERT_TRUE(order.empty());
+
+    // Positions past the components are rejected
+    ASSERT_FALSE(session.remove(2));
+    ASSERT_FALSE(session.modify(2, Component::from_string("C 1 2100 2010-03-01")));
+    ASSERT_EQ(2u, session.components().size());
+    ASSERT_TRUE(session.modify(0, Component::from_string("C 1 2100 2010-03-01")));
+    ASSERT_EQ("Call spread", session.current(order));
+}
+
+TEST_F(CombinationsTest, stream) {
+    using namespace std::chrono_literals;
+    const Stream::Clock::time_point start;
+    Stream stream(combinations(), 10s, 2);
+
+    stream.push(7, 2, Component::from_string("C 1 2100 2010-03-01"), start);
+    stream.push(3, 2, Component::from_string("F 1 2010-03-01"), start + 1s);
+    stream.push(3, 2, Component::from_string("F -1 2010-03-02"), start + 2s);
+    ASSERT_FALSE(stream.next().has_value());  // order 7 arrived first
+
+    stream.push(7, 2, Component::from_string("C -1 2200 2010-03-01"), start + 3s);
+    auto result = stream.next();
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(7u, result->id);
+    ASSERT_EQ(Stream::Result::Status::Complete, result->status);
+    ASSERT_EQ("Call spread", result->name);
+    ASSERT_EQ("Future calendar spread", stream.next()->name);
+
+    stream.push(1, 2, Component::from_string("U 1 2010-03-01"), start + 4s);
+    stream.push(2, 2, Component::from_string("U 1 2010-03-01"), start + 5s);
+    stream.push(4, 2, Component::from_string("U 1 2010-03-01"), start + 20s);
+    ASSERT_EQ(Stream::Result::Status::Evicted, stream.next()->status);
+    stream.expire(start + 20s);
+    result = stream.next();
+    ASSERT_EQ(2u, result->id);
+    ASSERT_EQ(Stream::Result::Status::Timeout, result->status);
+    ASSERT_EQ("Unclassified", result->name);
+    ASSERT_FALSE(stream.next().has_value());
+    ASSERT_EQ(1u, stream.open());
+
+    stream.flush();
+    ASSERT_EQ(4u, stream.next()->id);
+}
+
+TEST_F(CombinationsTest, stream_backlog) {
+    using namespace std::chrono_literals;
+    const Stream::Clock::time_point start;
+    Stream stream(combinations(), 10s, 2, 3);
+
+    stream.push(1, 2, Component::from_string("U 1 2010-03-01"), start);
+    for (std::uint64_t id = 2; id <= 4; ++id) {
+        stream.push(id, 1, Component::from_string("U 1 2010-03-01"), start);
+    }
+    ASSERT_EQ(1u, stream.dropped());  // order 1 was open, evicted and dropped
+    ASSERT_EQ(0u, stream.open());
+    for (std::uint64_t id = 2; id <= 4; ++id) {
+        ASSERT_EQ(id, stream.next()->id);
+    }
+    ASSERT_FALSE(stream.next().has_value());
+}
+
+TEST(ProtocolTest, round_trip) {
+    const Request request{42, {Component::from_string("C -1.5 2100.5 2010-03-01"),
+                               Component::from_string("F 2 2011-12-31")}};
+    const Response response{42, "Call spread", {2, 1}};
+    std::string data;
+    ASSERT_TRUE(request.encode(data));
+    ASSERT_TRUE(response.encode(data));
+
+    const auto length = Frame::length(data);
+    ASSERT_TRUE(length.has_value());
+    const auto decoded = Request::decode(std::string_view(data).substr(Frame::header, *length - Frame::header));
+    ASSERT_TRUE(decoded.has_value());
+    ASSERT_EQ(42u, decoded->id);
+    ASSERT_EQ(2u, decoded->components.size());
+    ASSERT_EQ(InstrumentType::C, decoded->components[0].type);
+    ASSERT_EQ(-1.5, decoded->components[0].ratio);
+    ASSERT_EQ(2100.5, decoded->components[0].strike);
+    ASSERT_EQ(111, decoded->components[1].expiration.tm_year);
+    ASSERT_EQ(11, decoded->components[1].expiration.tm_mon);
+    ASSERT_EQ(31, decoded->components[1].expiration.tm_mday);
+
+    const auto rest = std::string_view(data).substr(*length);
+    ASSERT_EQ(rest.size(), Frame::length(rest));
+    const auto answer = Response::decode(rest.substr(Frame::header));
+    ASSERT_TRUE(answer.has_value());
+    ASSERT_EQ("Call spread", answer->name);
+    ASSERT_EQ((std::vector<int>{2, 1}), answer->order);
+    ASSERT_EQ(Classification::Status::Classified, answer->status);
+
+    std::string exceeded;
+    Response{43, "Budget exceeded", {}, Classification::Status::BudgetExceeded}.encode(exceeded);
+    const auto over = Response::decode(std::string_view(exceeded).substr(Frame::header));
+    ASSERT_TRUE(over.has_value());
+    ASSERT_EQ(Classification::Status::BudgetExceeded, over->status);
+    exceeded.back() = 3;
+    ASSERT_FALSE(Response::decode(std::string_view(exceeded).substr(Frame::header)).has_value());
+
+    ASSERT_FALSE(Frame::length("abc").has_value());
+    ASSERT_FALSE(Request::decode(std::string_view(data).substr(Frame::header, *length - Frame::header - 1)));
+}
+
+// Counts are 16 bits, a message with more fails to encode and appends nothing
+TEST(ProtocolTest, counts) {
+    const std::vector<Component> components(65536, Component::from_string("F 1 2010-03-01"));
+    std::string data = "x";
+    ASSERT_FALSE((Request{1, components}.encode(data)));
+    ASSERT_FALSE((Captured{0, components}.encode(data)));
+    ASSERT_FALSE((Slow{{}, std::string(65536, 'a'), 0}.encode(data)));
+    ASSERT_FALSE((Response{1, "Strip", std::vector<int>(65536, 1)}.encode(data)));
+    ASSERT_FALSE((Response{1, "Strip", {1, 65536}}.encode(data)));
+    ASSERT_EQ("x", data);
+    ASSERT_TRUE((Request{1, {components.begin(), components.begin() + 65535}}.encode(data)));
+}
+
+TEST(ProtocolTest, capture) {
+    std::string data;
+    Captured{0, {Component::from_string("F 1 2010-03-01"), Component::from_string("F -1 2010-04-01")}}.encode(data);
+    Captured{1500, {Component::from_string("C 2 2100 2010-03-01")}}.encode(data);
+    data.pop_back();
+
+    // The truncated frame ends the capture
+    const auto messages = Frame::messages(data);
+    ASSERT_EQ(1u, messages.size());
+    const auto first = Captured::decode(messages[0]);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(0u, first->microseconds);
+    ASSERT_EQ(2u, first->components.size());
+    EXPECT_EQ(-1, first->components[1].ratio);
+    EXPECT_EQ(3, first->components[1].expiration.tm_mon);
+    EXPECT_FALSE(Captured::decode(messages[0].substr(1)).has_value());
+}
+
+TEST(CombinationsResourceTest, slow_log) {
+    const auto path = std::filesystem::temp_directory_path() / "combinations_test_slow_log";
+    std::filesystem::remove(path);
+    const std::vector<Component> straddle = {
+        Component::from_string("C 1 2100 2010-03-01"),
+        Component::from_string("P 1 2100 2010-03-01"),
+    };
+    const std::vector<Component> unknown = {Component::from_string("U 3 2010-03-01")};
+    {
+        // Every call is slower than no time at all
+        Combinations combinations;
+        ASSERT_TRUE(combinations.load(std::filesystem::path{"test/etc/combinations.xml"}));
+        ASSERT_TRUE(combinations.open_slow_log(path, std::chrono::nanoseconds(0)));
+        std::vector<int> order;
+        ASSERT_EQ("Straddle", combinations.classify(straddle, order));
+        ASSERT_EQ("Unclassified", combinations.classify(unknown, order));
+        EXPECT_EQ(0u, combinations.slow_log_dropped());
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    const std::string data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    const auto messages = Frame::messages(data);
+    ASSERT_EQ(2u, messages.size());
+    const auto first = Slow::decode(messages[0]);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ("Straddle", first->name);
+    ASSERT_EQ(2u, first->components.size());
+    EXPECT_EQ(InstrumentType::P, first->components[1].type);
+    EXPECT_EQ(2100, first->components[1].strike);
+    EXPECT_GT(first->nanoseconds, 0u);
+    const auto second = Slow::decode(messages[1]);
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ("Unclassified", second->name);
+    EXPECT_EQ(3, second->components[0].ratio);
+    std::filesystem::remove(path);
+}
+
+TEST_F(CombinationsTest, shared_catalogue) {
+    const std::string name = "/combinations-test";
+    ASSERT_TRUE(combinations().share(name));
+    Combinations shared;
+    ASSERT_TRUE(shared.attach(name));
+    ASSERT_TRUE(Catalogue::remove(name));  // the mapping stays valid
+
+    const std::vector<Component> butterfly = {
+        Component::from_string("C -1 2200 2010-03-01"),
+        Component::from_string("C 1 2100 2010-03-01"),
+        Component::from_string("P 1 2100 2010-03-01"),
+        Component::from_string("P -1 2000 2010-03-01"),
+    };
+    std::vector<int> order, expected;
+    ASSERT_EQ("Iron butterfly", shared.classify(butterfly, order));
+    combinations().classify(butterfly, expected);
+    ASSERT_EQ(expected, order);
+    const std::vector<Component> strip{6, Component::from_string("F 10 2010-03-01")};
+    ASSERT_EQ("Strip", shared.classify(strip, order));
+
+    Combinations missing;
+    ASSERT_FALSE(missing.attach(name));
+}
+
+TEST_F(CombinationsTest, catalogue_admits) {
+    const auto image = combinations().image();  // the entries point into it
+    std::vector<Catalogue::Entry> entries;
+    ASSERT_TRUE(Catalogue::read(image, entries));
+    const auto entry = [&entries](std::string_view name) {
+        return *std::find_if(entries.begin(), entries.end(), [name](const auto& e) { return e.name == name; });
+    };
+    const auto signature = [](std::initializer_list<InstrumentType> types) {
+        Signature result;
+        for (const auto type : types) {
+            result.add(type);
+        }
+        return result;
+    };
+    using enum InstrumentType;
+
+    const auto strip = entry("Strip");
+    ASSERT_EQ(Catalogue::Kind::More, strip.kind);
+    EXPECT_TRUE(Catalogue::admits(strip, signature({F, F, F})));
+    EXPECT_FALSE(Catalogue::admits(strip, signature({F})));
+    EXPECT_FALSE(Catalogue::admits(strip, signature({F, F, U})));
+    EXPECT_EQ(signature({F}), Catalogue::key(strip));
+
+    const auto butterfly = entry("Iron butterfly");
+    EXPECT_TRUE(Catalogue::admits(butterfly, signature({C, C, P, P})));
+    EXPECT_FALSE(Catalogue::admits(butterfly, signature({C, C, C, P})));
+    EXPECT_EQ(signature({C, C, P, P}), Catalogue::key(butterfly));
+}
+
+TEST_F(CombinationsTest, exclusive_types) {
+    EXPECT_TRUE(combinations().shadowed().empty());
+    EXPECT_TRUE(combinations().exclusive("Straddle", "Strangle"));
+    EXPECT_TRUE(combinations().exclusive("Call spread", "Call calendar spread"));
+    EXPECT_TRUE(combinations().exclusive("Straddle vs buy underlying", "Straddle vs sell underlying"));
+    EXPECT_TRUE(combinations().exclusive("Straddle", "Future calendar spread"));
+    EXPECT_FALSE(combinations().exclusive("Inter commodity spread", "Future calendar spread"));
+    EXPECT_FALSE(combinations().exclusive("Straddle", "Unknown"));
+}
+
+TEST_F(CombinationsTest, adaptive_order) {
+    Combinations adaptive;
+    ASSERT_TRUE(adaptive.load(std::filesystem::path{"test/etc/combinations.xml"}));
+    adaptive.set_adaptive(true);
+
+    // Mostly straddles over several reorders, the other inputs have to keep their result
+    const std::vector<std::vector<Component>> inputs = {
+        {Component::from_string("C 1 2100 2010-03-01"), Component::from_string("P 1 2100 2010-03-01")},
+        {Component::from_string("C 1 2200 2010-03-01"), Component::from_string("P 1 2100 2010-03-01")},
+        {Component::from_string("C 1 2100 2010-03-01"), Component::from_string("P -1 2100 2010-03-01")},
+        {Component::from_string("F 1 2010-03-01"), Component::from_string("F -1 2010-04-01")},
+        {Component::from_string("C 1 2100 2010-03-01"), Component::from_string("P 2 2100 2010-03-01")},
+    };
+    std::vector<int> expected_order, order;
+    for (std::size_t n = 0; n < 3 * Adaptive::period; ++n) {
+        const auto& components = inputs[n % 8 < 4 ? 0 : n % inputs.size()];
+        const auto expected    = combinations().classify(components, expected_order);
+        ASSERT_EQ(expected, adaptive.classify(components, order)) << n;
+        ASSERT_EQ(expected_order, order) << n;
+    }
+}
+
+TEST_F(CombinationsTest, instances) {
+    const auto image = combinations().image();
+    Instances generator(combinations(), image, 7);
+    ASSERT_FALSE(generator.types().empty());
+    for (const auto& entry : generator.types()) {
+        const std::string name(entry.name);
+        const auto positive = generator.positive(entry);
+        ASSERT_FALSE(positive.empty()) << name;
+        ASSERT_GT(combinations().count_orderings(name, positive), 0) << name;
+        const auto near_miss = generator.near_miss(entry);
+        ASSERT_FALSE(near_miss.empty()) << name;
+        ASSERT_EQ(0, combinations().count_orderings(name, near_miss)) << name;
+    }
+}
+
+// Inputs of the fuzz target, those it found slow or wrong included
+TEST_F(CombinationsTest, fuzz_corpus) {
+    std::size_t inputs = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(COMBINATIONS_CORPUS)) {
+        std::ifstream file(entry.path(), std::ios::binary);
+        const std::string data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        EXPECT_EQ("", fuzz_failure(combinations(), data)) << entry.path();
+        ++inputs;
+    }
+    ASSERT_GT(inputs, 0);
+}
+
+TEST_F(CombinationsTest, builtin_catalogue) {
+    Combinations builtin;
+    if (!builtin.load_builtin()) {
+        GTEST_SKIP() << "built without the catalogue";
+    }
+    ASSERT_EQ(combinations().image().size(), builtin.image().size());
+
+    const std::vector<Component> components = {
+        Component::from_string("C 1 2100 2010-03-01"),
+        Component::from_string("C -1 2200 2010-03-01"),
+    };
+    std::vector<int> order;
+    ASSERT_EQ("Call spread", builtin.classify(components, order));
+}
+
 // name: Inter commodity spread
 // shortname: ICS
 // identifier: 832c4a6e-bd64-11e2-a706-f9d5a0549fe0
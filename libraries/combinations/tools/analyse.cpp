@@ -0,0 +1,53 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "combinations/Combinations.hpp"
+#include "pugixml.hpp"
+
+// Reports the dead types of a combinations XML resource, those classify never returns as an earlier type matches
+// whatever they match, and how many pairs of types no components match both
+
+namespace {
+
+template <typename... Args>
+int fail(Args &&...args) noexcept {
+    ((std::cerr << args), ...);
+    std::cerr << std::endl;
+    return 1;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        return fail("Usage: analyse <combinations XML resource>");
+    }
+
+    Combinations combinations;
+    const std::filesystem::path path{argv[1]};
+    pugi::xml_document doc;
+    if (!combinations.load(path) || !doc.load_file(path.c_str())) {
+        return fail("Failed to load combinations XML resource from ", path);
+    }
+    std::vector<std::string> names;
+    for (const auto &combination : doc.child("combinations")) {
+        names.emplace_back(combination.attribute("name").value());
+    }
+
+    const auto shadowed = combinations.shadowed();
+    std::cout << "types: " << names.size() << ", dead: " << shadowed.size() << std::endl;
+    for (const auto &type : shadowed) {
+        std::cout << type.name << "\tshadowed by\t" << type.by << std::endl;
+    }
+
+    std::size_t pairs = 0, exclusive = 0;
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        for (std::size_t j = i + 1; j < names.size(); ++j) {
+            ++pairs;
+            exclusive += combinations.exclusive(names[i], names[j]);
+        }
+    }
+    std::cout << "exclusive pairs: " << exclusive << " of " << pairs << std::endl;
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include <fstream>
+#include <iostream>
+
+#include "combinations/Combinations.hpp"
+
+// Compiles a combinations XML resource into the catalogue image load_builtin uses, written as the initialiser of a
+// byte array
+
+namespace {
+
+const std::size_t bytes_per_line = 24;
+
+template <typename... Args>
+int fail(Args &&...args) noexcept {
+    ((std::cerr << args), ...);
+    std::cerr << std::endl;
+    return 1;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        return fail("Usage: embed <combinations XML resource> <output file>");
+    }
+
+    Combinations combinations;
+    const std::filesystem::path path{argv[1]};
+    if (!combinations.load(path)) {
+        return fail("Failed to load combinations XML resource from ", path);
+    }
+
+    const auto image = combinations.image();
+    std::ofstream out(argv[2]);
+    for (std::size_t i = 0; i < image.size(); ++i) {
+        out << std::to_integer<unsigned>(image[i]) << (i % bytes_per_line + 1 == bytes_per_line ? ",\n" : ",");
+    }
+    out << '\n';
+    if (!out) {
+        return fail("Failed to write ", argv[2]);
+    }
+    return 0;
+}
@@ -0,0 +1,59 @@
+#ifndef COMBINATIONS_TOOLS_FUZZ_HPP
+#define COMBINATIONS_TOOLS_FUZZ_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "combinations/Budget.hpp"
+#include "combinations/Combinations.hpp"
+#include "combinations/Component.hpp"
+
+// A fuzz input is one component per line as the combinations tool reads them, a line that does not parse is skipped
+// and at most fuzz_max_components are kept
+constexpr std::size_t fuzz_max_components = 32;
+// Time a classify call of a fuzz input may take
+constexpr std::chrono::milliseconds fuzz_budget{100};
+
+inline std::vector<Component> fuzz_components(std::string_view data) {
+    std::vector<Component> components;
+    while (!data.empty() && components.size() < fuzz_max_components) {
+        const auto end       = std::min(data.find('\n'), data.size());
+        const auto component = Component::from_string(std::string(data.substr(0, end)));
+        if (component.type != InstrumentType::Unknown) {
+            components.push_back(component);
+        }
+        data.remove_prefix(std::min(end + 1, data.size()));
+    }
+    return components;
+}
+
+// What is wrong with classifying the input, empty if nothing: the budget is exceeded or the order of a classified
+// input is not a permutation of its components
+inline std::string fuzz_failure(const Combinations& combinations, std::string_view data) {
+    const auto components = fuzz_components(data);
+    std::vector<int> order;
+    Budget budget(fuzz_budget);
+    const auto result = combinations.classify(components, order, budget);
+    if (result.status == Classification::Status::BudgetExceeded) {
+        return "classify of " + std::to_string(components.size()) + " components exceeded the budget after " +
+               std::to_string(budget.assignments) + " assignments";
+    }
+    if (result.status == Classification::Status::Classified) {
+        if (order.size() != components.size()) {
+            return result.name + " returned an order of " + std::to_string(order.size()) + " positions for " +
+                   std::to_string(components.size()) + " components";
+        }
+        std::sort(order.begin(), order.end());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            if (order[i] != static_cast<int>(i + 1)) {
+                return result.name + " returned an order that is not a permutation of the components";
+            }
+        }
+    }
+    return {};
+}
+
+#endif  // COMBINATIONS_TOOLS_FUZZ_HPP
@@ -0,0 +1,44 @@
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "synthetic.hpp"
+
+// Writes a synthetic combinations XML resource of the given number of types made of venue variants of the types of a
+// resource, for trying the library on a catalogue of the size of the production one
+
+namespace {
+
+template <typename... Args>
+int fail(Args &&...args) noexcept {
+    ((std::cerr << args), ...);
+    std::cerr << std::endl;
+    return 1;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    if (argc != 4) {
+        return fail("Usage: generate <combinations XML resource> <number of types> <output file>");
+    }
+
+    std::ifstream source_file(argv[1]);
+    std::stringstream source;
+    source << source_file.rdbuf();
+    if (!source_file) {
+        return fail("Failed to read ", argv[1]);
+    }
+
+    const auto resource = synthesize(source.str(), std::stoul(argv[2]));
+    if (resource.empty()) {
+        return fail("Malformed combination element in ", argv[1]);
+    }
+    std::ofstream out(argv[3]);
+    out << resource;
+    if (!out) {
+        return fail("Failed to write ", argv[3]);
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "combinations/Combinations.hpp"
+#include "combinations/Protocol.hpp"
+#include "instances.hpp"
+
+// Writes positive and near-miss inputs of every type of a combinations XML resource to the standard output, as the
+// combinations tool reads them or with --binary as a capture the traffic benchmark replays. The types no positive
+// instance was found for are reported on the standard error
+
+namespace {
+
+const std::uint64_t seed = 42;
+
+template <typename... Args>
+int fail(Args &&...args) noexcept {
+    ((std::cerr << args), ...);
+    std::cerr << std::endl;
+    return 1;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    const bool binary = argc > 2 && std::string_view(argv[argc - 1]) == "--binary";
+    const int given   = argc - (binary ? 1 : 0);
+    if (given != 2 && given != 3) {
+        return fail("Usage: instances <combinations XML resource> [instances per type] [--binary]");
+    }
+    Combinations combinations;
+    if (!combinations.load(std::filesystem::path{argv[1]})) {
+        return fail("Failed to load combinations XML resource from ", argv[1]);
+    }
+    const std::size_t per_type = given == 3 ? std::stoul(argv[2]) : 1;
+    const auto image           = combinations.image();
+    Instances generator(combinations, image, seed);
+
+    std::size_t inputs = 0, positives = 0, negatives = 0;
+    std::vector<std::string_view> missing;
+    std::string frames;
+    const auto put = [&](const std::vector<Component> &components) {
+        if (binary) {
+            Captured{inputs, components}.encode(frames);
+        } else {
+            Instances::write(std::cout, components);
+        }
+        ++inputs;
+    };
+    for (const auto &entry : generator.types()) {
+        bool found = false, missed = false;
+        for (std::size_t i = 0; i < per_type; ++i) {
+            if (const auto components = generator.positive(entry); !components.empty()) {
+                put(components);
+                found = true;
+            }
+            if (const auto components = generator.near_miss(entry); !components.empty()) {
+                put(components);
+                missed = true;
+            }
+        }
+        positives += found;
+        negatives += missed;
+        if (!found) {
+            missing.push_back(entry.name);
+        }
+    }
+    if (binary) {
+        std::cout.write(frames.data(), static_cast<std::streamsize>(frames.size()));
+    }
+
+    std::cerr << "types: " << generator.types().size() << ", with positives: " << positives
+              << ", with near misses: " << negatives << ", inputs: " << inputs << std::endl;
+    for (const auto name : missing) {
+        std::cerr << "no positive instance of " << name << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,253 @@
+#ifndef COMBINATIONS_TOOLS_INSTANCES_HPP
+#define COMBINATIONS_TOOLS_INSTANCES_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <ostream>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "combinations/Catalogue.hpp"
+#include "combinations/Combinations.hpp"
+#include "combinations/Component.hpp"
+#include "combinations/Tolerance.hpp"
+
+// Random inputs of the types of a catalogue. A positive instance of a type is built leg by leg from its constraints:
+// letters bind values, offsets of a group are ordered around the value of its base, periods are taken from the base
+// expiration and a Multiple or a More gets a random size. A near miss is a positive with one thing changed so that the
+// type no longer matches it. Every instance is checked against the type before it is returned
+class Instances {
+public:
+    // The types of the combinations, their image has to outlive the generator
+    Instances(const Combinations& combinations, std::span<const std::byte> image, std::uint64_t seed)
+        : combinations(combinations), gen(seed) {
+        Catalogue::read(image, entries);
+    }
+
+    const std::vector<Catalogue::Entry>& types() const { return entries; }
+
+    // Empty if no attempt gave an instance
+    std::vector<Component> positive(const Catalogue::Entry& entry) {
+        for (std::size_t attempt = 0; attempt < attempts; ++attempt) {
+            auto components = build(entry);
+            if (matches(entry, components)) {
+                std::shuffle(components.begin(), components.end(), gen);
+                return components;
+            }
+        }
+        return {};
+    }
+
+    std::vector<Component> near_miss(const Catalogue::Entry& entry) {
+        for (std::size_t attempt = 0; attempt < attempts; ++attempt) {
+            auto components = positive(entry);
+            if (components.empty()) {
+                return {};
+            }
+            mutate(components);
+            if (!components.empty() && !matches(entry, components)) {
+                return components;
+            }
+        }
+        return {};
+    }
+
+    // As the combinations tool reads an input: the number of components, then one component per line
+    static void write(std::ostream& out, const std::vector<Component>& components) {
+        out << components.size() << '\n';
+        for (const auto& component : components) {
+            out << static_cast<char>(component.type) << ' ' << component.ratio << ' ';
+            if (component.type == InstrumentType::C || component.type == InstrumentType::P ||
+                component.type == InstrumentType::O) {
+                out << component.strike << ' ';
+            }
+            out << std::put_time(&component.expiration, "%Y-%m-%d") << '\n';
+        }
+    }
+
+private:
+    static constexpr std::size_t attempts   = 20;
+    static constexpr InstrumentType kinds[] = {InstrumentType::C, InstrumentType::F, InstrumentType::O,
+                                               InstrumentType::P, InstrumentType::U};
+
+    // Values of one dimension as the legs of a block bind them
+    template <class T>
+    struct Binding {
+        std::map<char, T> letters;
+        std::map<int, T> levels;  // of the current group by offset level, the base at 0
+    };
+
+    bool matches(const Catalogue::Entry& entry, const std::vector<Component>& components) const {
+        return combinations.count_orderings(std::string(entry.name), components) > 0;
+    }
+
+    std::vector<Component> build(const Catalogue::Entry& entry) {
+        std::vector<Component> components;
+        if (entry.kind == Catalogue::Kind::More) {
+            const auto& leg = entry.legs.front();
+            auto mask       = leg.mask;
+            if (leg.type == InstrumentType::O) {
+                mask |= Leg::bit(InstrumentType::P) | Leg::bit(InstrumentType::C);
+            }
+            const auto count = entry.min_count + gen() % 3;
+            for (std::size_t i = 0; i < count; ++i) {
+                auto& component      = components.emplace_back();
+                component.type       = type(mask);
+                component.ratio      = ratio(entry, leg);
+                component.strike     = strike(component.type, 2000 + 100 * static_cast<double>(gen() % 5));
+                component.expiration = date(base_date(), 0, OffsetType::Month);
+            }
+            return components;
+        }
+        const std::size_t blocks = entry.kind == Catalogue::Kind::Multiple ? 1 + gen() % 3 : 1;
+        for (std::size_t block = 0; block < blocks; ++block) {
+            Binding<double> strikes;
+            Binding<std::tm> expirations;
+            for (std::size_t j = 0; j < entry.legs.size(); ++j) {
+                const auto& leg      = entry.legs[j];
+                auto& component      = components.emplace_back();
+                component.type       = type(leg.mask);
+                component.ratio      = ratio(entry, leg);
+                component.strike     = strike(component.type, bind(strikes, entry.legs, j, &Leg::strike));
+                component.expiration = bind(expirations, entry.legs, j, &Leg::expiration);
+            }
+        }
+        return components;
+    }
+
+    InstrumentType type(std::uint8_t mask) {
+        std::vector<InstrumentType> fitting;
+        for (const auto kind : kinds) {
+            if ((mask & Leg::bit(kind)) != 0) {
+                fitting.push_back(kind);
+            }
+        }
+        return fitting[gen() % fitting.size()];
+    }
+
+    double ratio(const Catalogue::Entry& entry, const Leg& leg) {
+        if (leg.sign) {
+            return (leg.ratio > 0 ? 1 : -1) * static_cast<double>(1 + gen() % 3);
+        }
+        return static_cast<double>(leg.ratio * entry.unit) / Tolerance::ratio_ticks;
+    }
+
+    static double strike(InstrumentType type, double value) {
+        return type == InstrumentType::F || type == InstrumentType::U ? 0 : value;
+    }
+
+    std::tm base_date() {
+        std::tm tm{};
+        tm.tm_year = 110 + static_cast<int>(gen() % 3);
+        tm.tm_mon  = static_cast<int>(gen() % 12);
+        tm.tm_mday = 1 + static_cast<int>(gen() % 28);
+        return tm;
+    }
+
+    // The date moved by the amount of the unit, normalised as expiration periods are checked
+    static std::tm date(std::tm tm, int amount, OffsetType unit) {
+        switch (unit) {
+        case OffsetType::Year:
+            tm.tm_year += amount;
+            break;
+        case OffsetType::Quoter:
+            tm.tm_mon += 3 * amount;
+            break;
+        case OffsetType::Month:
+            tm.tm_mon += amount;
+            break;
+        case OffsetType::Day:
+            tm.tm_mday += amount;
+            break;
+        }
+        std::mktime(&tm);
+        return tm;
+    }
+
+    double fresh(const Binding<double>&) { return 2000 + 100 * static_cast<double>(gen() % 5); }
+    std::tm fresh(const Binding<std::tm>&) { return base_date(); }
+    // A value one to three steps past the given one, a strike step is 50 and a date step a month
+    double step(double value, int direction) { return value + 50 * direction * static_cast<int>(1 + gen() % 3); }
+    std::tm step(const std::tm& value, int direction) {
+        return date(value, direction * static_cast<int>(1 + gen() % 3), OffsetType::Month);
+    }
+    // Expiration of a period leg from the base of its group
+    static double moved(double value, const Leg&) { return value; }
+    static std::tm moved(const std::tm& base, const Leg& leg) { return date(base, leg.expiration, leg.unit); }
+
+    // Value of the dimension of the leg at the position. A letter leg, or the first leg of the block, starts a group
+    // whose offset levels all get their values at once, ordered around the base at level 0
+    template <class T>
+    T bind(Binding<T>& binding, std::span<const Leg> legs, std::size_t position, std::int32_t Leg::*dimension) {
+        const auto& leg   = legs[position];
+        const bool letter = leg.kind(dimension) == Leg::Letter;
+        if (position == 0 || letter) {
+            auto base = fresh(binding);
+            if (letter && leg.*dimension != '\0') {
+                base = binding.letters.emplace(static_cast<char>(leg.*dimension), base).first->second;
+            }
+            std::vector<int> levels;
+            auto k = position + (letter ? 1 : 0);
+            for (; k < legs.size() && legs[k].kind(dimension) != Leg::Letter; ++k) {
+                if (legs[k].kind(dimension) == Leg::Offset) {
+                    levels.push_back(legs[k].*dimension);
+                }
+            }
+            std::sort(levels.begin(), levels.end());
+            binding.levels = {{0, base}};
+            for (const auto level : levels) {
+                if (level > 0 && !binding.levels.contains(level)) {
+                    binding.levels[level] = step(std::prev(binding.levels.end())->second, 1);
+                }
+            }
+            for (auto level = levels.rbegin(); level != levels.rend(); ++level) {
+                if (*level < 0 && !binding.levels.contains(*level)) {
+                    binding.levels[*level] = step(binding.levels.begin()->second, -1);
+                }
+            }
+        }
+        switch (leg.kind(dimension)) {
+        case Leg::Letter:
+            return binding.levels[0];
+        case Leg::Offset:
+            return binding.levels[leg.*dimension];
+        default:
+            return moved(binding.levels[0], leg);
+        }
+    }
+
+    // One change a type is likely to notice: a ratio, a strike, an expiration or a type changed, or a component lost
+    void mutate(std::vector<Component>& components) {
+        auto& component = components[gen() % components.size()];
+        switch (gen() % 5) {
+        case 0:
+            component.ratio = gen() % 2 == 0 ? -component.ratio : 2 * component.ratio;
+            break;
+        case 1:
+            component.strike = strike(component.type, component.strike + 50);
+            break;
+        case 2:
+            component.expiration = date(component.expiration, 1, OffsetType::Day);
+            break;
+        case 3:
+            component.type   = kinds[gen() % std::size(kinds)];
+            component.strike = strike(component.type, component.strike == 0 ? 2000 : component.strike);
+            break;
+        default:
+            components.erase(components.begin() + static_cast<std::ptrdiff_t>(&component - components.data()));
+            break;
+        }
+    }
+
+    const Combinations& combinations;
+    std::vector<Catalogue::Entry> entries;
+    std::mt19937_64 gen;
+};
+
+#endif  // COMBINATIONS_TOOLS_INSTANCES_HPP
@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "combinations/Combinations.hpp"
+#include "combinations/Protocol.hpp"
+
+// Replays a slow log against a combinations XML resource: every captured input is classified again a few times and
+// its recorded time and name are printed next to the median time and the name of the replay
+
+namespace {
+
+const std::size_t repeats = 5;
+
+template <typename... Args>
+int fail(Args &&...args) noexcept {
+    ((std::cerr << args), ...);
+    std::cerr << std::endl;
+    return 1;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        return fail("Usage: slowlog <combinations XML resource> <slow log>");
+    }
+    Combinations combinations;
+    if (!combinations.load(std::filesystem::path{argv[1]})) {
+        return fail("Failed to load combinations XML resource from ", argv[1]);
+    }
+    std::ifstream file(argv[2], std::ios::binary);
+    if (!file) {
+        return fail("Failed to open the slow log ", argv[2]);
+    }
+    const std::string data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+    std::cout << "#\tlegs\trecorded, us\treplayed, us\trecorded\treplayed" << std::endl;
+    std::size_t index = 0;
+    for (const auto message : Frame::messages(data)) {
+        const auto slow = Slow::decode(message);
+        if (!slow) {
+            return fail("Failed to read record ", index);
+        }
+        std::vector<double> times;
+        std::string name;
+        for (std::size_t r = 0; r < repeats; ++r) {
+            std::vector<int> order;
+            const auto start   = std::chrono::steady_clock::now();
+            name               = combinations.classify(slow->components, order);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            times.push_back(std::chrono::duration<double, std::micro>(elapsed).count());
+        }
+        std::sort(times.begin(), times.end());
+        std::cout << index++ << '\t' << slow->components.size() << '\t'
+                  << static_cast<double>(slow->nanoseconds) / 1000 << '\t' << times[repeats / 2] << '\t' << slow->name
+                  << '\t' << name << std::endl;
+    }
+    return 0;
+}
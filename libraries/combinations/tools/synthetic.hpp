@@ -0,0 +1,41 @@
+#ifndef COMBINATIONS_TOOLS_SYNTHETIC_HPP
+#define COMBINATIONS_TOOLS_SYNTHETIC_HPP
+
+#include <string>
+#include <vector>
+
+// Synthetic resource of the given number of types: venue variants of the types of an XML resource, copies of its
+// combination elements with the venue appended to their names, every variant of a type right after the previous one.
+// Empty if a combination element has no end or no name
+inline std::string synthesize(const std::string &source, std::size_t types) {
+    const std::string end_tag = "</combination>", name_attribute = "name=\"";
+    std::vector<std::string> elements;
+    for (auto begin = source.find("<combination "); begin != std::string::npos;
+         begin      = source.find("<combination ", begin)) {
+        const auto end = source.find(end_tag, begin);
+        if (end == std::string::npos) {
+            return {};
+        }
+        elements.push_back(source.substr(begin, end + end_tag.size() - begin));
+        const auto name = elements.back().find(name_attribute);
+        if (name == std::string::npos || elements.back().find('"', name + name_attribute.size()) == std::string::npos) {
+            return {};
+        }
+        begin = end + end_tag.size();
+    }
+    std::string resource = "<?xml version=\"1.0\"?>\n<combinations>\n";
+    if (elements.empty()) {
+        return resource + "</combinations>\n";
+    }
+    const auto venues = (types + elements.size() - 1) / elements.size();
+    for (std::size_t i = 0; i < types; ++i) {
+        auto element    = elements[i / venues];
+        const auto name = element.find('"', element.find(name_attribute) + name_attribute.size());
+        element.insert(name, std::to_string(i % venues));
+        element.insert(name, 1, ' ');
+        resource += element + '\n';
+    }
+    return resource + "</combinations>\n";
+}
+
+#endif  // COMBINATIONS_TOOLS_SYNTHETIC_HPP
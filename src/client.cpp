@@ -0,0 +1,173 @@
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "combinations/Component.hpp"
+#include "combinations/Protocol.hpp"
+
+// Load generator of combinations-server: every connection keeps a number of requests in flight and the latency of
+// each request is measured from its send to its response
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename... Args>
+int fail(Args &&...args) noexcept {
+    ((std::cerr << args), ...);
+    std::cerr << std::endl;
+    return 1;
+}
+
+std::vector<std::vector<Component>> make_inputs() {
+    const std::vector<std::vector<std::string>> legs = {
+        {"F 1 2010-03-01", "F -1 2010-04-01"},
+        {"C 1 2100 2010-03-01", "C -1 2200 2010-03-01"},
+        {"C -1 2200 2010-03-01", "C 1 2100 2010-03-01", "P 1 2100 2010-03-01", "P -1 2000 2010-03-01"},
+        {"C 1 2000 2010-03-01", "C -2 2100 2010-03-01", "C 1 2200 2010-03-01"},
+        {"F 1 2010-03-01", "F 1 2010-04-01", "F 1 2010-05-01", "F 1 2010-06-01"},
+        {"U 1 2010-03-01", "P 1 2100 2010-03-01", "C -1 2200 2010-03-01"},
+    };
+    std::vector<std::vector<Component>> inputs;
+    for (const auto &input : legs) {
+        auto &components = inputs.emplace_back();
+        for (const auto &leg : input) {
+            components.push_back(Component::from_string(leg));
+        }
+    }
+    return inputs;
+}
+
+int connect_to(const std::string &path) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+bool send_all(int fd, const std::string &data) {
+    for (std::size_t sent = 0; sent < data.size();) {
+        const auto written = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (written < 0) {
+            return false;
+        }
+        sent += static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+// Latencies of the requests of one connection in microseconds, empty on a failure
+std::vector<double> run(const std::string &path, std::size_t requests, std::size_t depth,
+                        const std::vector<std::vector<Component>> &inputs) {
+    const int fd = connect_to(path);
+    if (fd < 0) {
+        return {};
+    }
+    std::vector<Clock::time_point> sent(requests);
+    std::vector<double> latencies;
+    latencies.reserve(requests);
+    std::string out, in;
+    char buffer[1 << 16];
+
+    for (std::size_t next = 0; latencies.size() < requests;) {
+        out.clear();
+        for (; next < requests && next - latencies.size() < depth; ++next) {
+            if (!Request{next, inputs[next % inputs.size()]}.encode(out)) {
+                ::close(fd);
+                return {};
+            }
+            sent[next] = Clock::now();
+        }
+        if (!send_all(fd, out)) {
+            break;
+        }
+
+        const auto read = ::recv(fd, buffer, sizeof(buffer), 0);
+        if (read <= 0) {
+            break;
+        }
+        in.append(buffer, static_cast<std::size_t>(read));
+        std::size_t offset = 0;
+        for (;;) {
+            const auto data   = std::string_view(in).substr(offset);
+            const auto length = Frame::length(data);
+            if (!length || data.size() < *length) {
+                break;
+            }
+            const auto response = Response::decode(data.substr(Frame::header, *length - Frame::header));
+            if (!response || response->id >= requests) {
+                ::close(fd);
+                return {};
+            }
+            const std::chrono::duration<double, std::micro> latency = Clock::now() - sent[response->id];
+            latencies.push_back(latency.count());
+            offset += *length;
+        }
+        in.erase(0, offset);
+    }
+    ::close(fd);
+    if (latencies.size() < requests) {
+        return {};
+    }
+    return latencies;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    if (argc < 2 || argc > 5) {
+        return fail(
+            "Usage: combinations-client <socket path> [connections] [requests per connection] [requests in flight]");
+    }
+    const std::string path        = argv[1];
+    const std::size_t connections = argc > 2 ? std::stoul(argv[2]) : 4;
+    const std::size_t requests    = argc > 3 ? std::stoul(argv[3]) : 100000;
+    const std::size_t depth       = argc > 4 ? std::stoul(argv[4]) : 64;
+    const auto inputs             = make_inputs();
+
+    std::vector<std::vector<double>> latencies(connections);
+    std::vector<std::thread> threads;
+    const auto start = Clock::now();
+    for (std::size_t i = 0; i < connections; ++i) {
+        threads.emplace_back([&, i] { latencies[i] = run(path, requests, depth, inputs); });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+
+    std::vector<double> all;
+    for (const auto &connection : latencies) {
+        if (connection.empty()) {
+            return fail("Failed to talk to combinations-server at ", path);
+        }
+        all.insert(all.end(), connection.begin(), connection.end());
+    }
+    if (all.empty()) {
+        return fail("No requests sent");
+    }
+    std::sort(all.begin(), all.end());
+    const auto percentile = [&all](double p) { return all[static_cast<std::size_t>(p * (all.size() - 1))]; };
+
+    std::cout << "requests: " << all.size() << ", throughput: " << static_cast<double>(all.size()) / elapsed.count()
+              << " requests/s" << std::endl;
+    std::cout << "latency, us: p50 " << percentile(0.5) << ", p99 " << percentile(0.99) << ", p999 "
+              << percentile(0.999) << std::endl;
+    return 0;
+}
@@ -1,11 +1,24 @@
+#include <chrono>
+#include <fstream>
 #include <iostream>
 #include <string>
+#include <string_view>
 
 #include "combinations/Combinations.hpp"
 #include "combinations/Component.hpp"
+#include "combinations/Protocol.hpp"
 
 namespace {
 
+using Clock = std::chrono::steady_clock;
+
+// Catalogue a process published with --share, e.g. shm:/combinations
+constexpr std::string_view shared_prefix = "shm:";
+// File of the classifications kept across runs, --cache <file>
+constexpr std::string_view cache_option = "--cache";
+// Capture of the inputs with the time they were read, --record <file>
+constexpr std::string_view record_option = "--record";
+
 template <typename... Args>
 int fail(Args &&...args) noexcept {
     ((std::cerr << args), ...);
@@ -16,37 +29,96 @@ int fail(Args &&...args) noexcept {
 }  // anonymous namespace
 
 int main(int argc, char *argv[]) {
-    if (argc != 2) {
-        return fail("Usage: combinations <combinations XML resource>");
+    if (argc == 4 && std::string_view(argv[1]) == "--share") {
+        Combinations combinations;
+        const std::filesystem::path path{argv[3]};
+        if (!combinations.load(path)) {
+            return fail("Failed to load combinations XML resource from ", path);
+        }
+        if (!combinations.share(argv[2])) {
+            return fail("Failed to share combinations as ", argv[2]);
+        }
+        return 0;
+    }
+    const char *cache = nullptr, *record = nullptr;
+    for (; argc >= 3 && (argv[1] == cache_option || argv[1] == record_option); argv += 2, argc -= 2) {
+        (argv[1] == cache_option ? cache : record) = argv[2];
+    }
+    if (argc > 2) {
+        return fail("Usage: combinations [", cache_option, " <cache file>] [", record_option,
+                    " <capture file>] [combinations XML resource | ", shared_prefix, "<shared catalogue name>]\n",
+                    "       combinations --share <shared catalogue name> <combinations XML resource>");
     }
 
     Combinations combinations;
 
-    const std::filesystem::path path{argv[1]};
-    if (!combinations.load(path)) {
+    const std::string_view source{argc == 2 ? argv[1] : ""};
+    if (source.empty()) {
+        if (!combinations.load_builtin()) {
+            return fail("No combinations XML resource given and none is built in");
+        }
+    } else if (source.starts_with(shared_prefix)) {
+        if (!combinations.attach(std::string(source.substr(shared_prefix.size())))) {
+            return fail("Failed to attach to shared combinations ", source);
+        }
+    } else if (const std::filesystem::path path{source}; !combinations.load(path)) {
         return fail("Failed to load combinations XML resource from ", path);
     }
 
-    std::size_t num;
-    std::cin >> num;
-    if (std::cin.fail()) {
-        return fail("Invalid number of legs");
+    if (cache != nullptr && !combinations.open_cache(cache)) {
+        return fail("Failed to open the cache ", cache);
     }
-
-    std::vector<Component> components;
-    components.reserve(num);
-    while (num--) {
-        components.emplace_back(Component::from_stream(std::cin));
-        if (components.back().type == InstrumentType::Unknown) {
-            return fail("Failed to read component");
+    std::ofstream capture;
+    if (record != nullptr) {
+        capture.open(record, std::ios::binary | std::ios::trunc);
+        if (!capture) {
+            return fail("Failed to open the capture ", record);
         }
     }
+    const auto start = Clock::now();
 
-    std::vector<int> order;
-    std::cout << combinations.classify(components, order) << std::endl;
-    for (const auto i : order) {
-        std::cout << i << std::endl;
+    // Inputs one after another up to the end of the input, each classified as it is read
+    std::size_t num, inputs = 0, hits = 0;
+    while (std::cin >> num || inputs == 0) {
+        if (std::cin.fail()) {
+            return fail("Invalid number of legs");
+        }
+
+        std::vector<Component> components;
+        components.reserve(num);
+        while (num--) {
+            components.emplace_back(Component::from_stream(std::cin));
+            if (components.back().type == InstrumentType::Unknown) {
+                return fail("Failed to read component");
+            }
+        }
+
+        if (record != nullptr) {
+            const auto time = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+            std::string frame;
+            if (!Captured{static_cast<std::uint64_t>(time.count()), components}.encode(frame)) {
+                return fail("Failed to record an input of ", components.size(), " components");
+            }
+            capture.write(frame.data(), static_cast<std::streamsize>(frame.size()));
+        }
+
+        std::vector<int> order;
+        Budget budget;
+        const auto result = combinations.classify(components, order, budget);
+        std::cout << result.name << std::endl;
+        for (const auto i : order) {
+            std::cout << i << std::endl;
+        }
+        ++inputs;
+        hits += result.cached;
+    }
+    if (!std::cin.eof()) {
+        return fail("Invalid number of legs");
     }
 
+    if (cache != nullptr) {
+        std::cerr << "cache hits: " << hits << " of " << inputs << " ("
+                  << 100 * static_cast<double>(hits) / static_cast<double>(inputs) << "%)" << std::endl;
+    }
     return 0;
 }
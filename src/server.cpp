@@ -0,0 +1,376 @@
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "combinations/Combinations.hpp"
+#include "combinations/Protocol.hpp"
+
+// Classifies requests of many local processes with one loaded catalogue. An epoll loop reads the frames of every
+// connection and hands the requests to a pool of workers, so the requests of one connection are pipelined and the
+// responses come back as they are ready, matched to their requests by id
+
+namespace {
+
+// Requests of one connection in the pool at once, reading from it stops above that
+const std::size_t max_pending = 1024;
+// Time a worker spends on one request, a request over it is answered with BudgetExceeded so the requests behind it
+// in the pool do not wait on it
+const auto request_budget = std::chrono::milliseconds(100);
+
+enum Source : std::uint64_t { Listener, Wakeup, Signals, Connections };
+
+template <typename... Args>
+int fail(Args &&...args) noexcept {
+    ((std::cerr << args), ...);
+    std::cerr << std::endl;
+    return 1;
+}
+
+template <class T>
+class Queue {
+public:
+    void push(T item) {
+        {
+            std::lock_guard lock(mutex);
+            items.push_back(std::move(item));
+        }
+        ready.notify_one();
+    }
+
+    // Blocks until there is an item, nullopt once the queue is closed
+    std::optional<T> pop() {
+        std::unique_lock lock(mutex);
+        ready.wait(lock, [this] { return !items.empty() || closed; });
+        if (items.empty()) {
+            return std::nullopt;
+        }
+        auto item = std::move(items.front());
+        items.pop_front();
+        return item;
+    }
+
+    std::deque<T> take() {
+        std::lock_guard lock(mutex);
+        return std::exchange(items, {});
+    }
+
+    void close() {
+        {
+            std::lock_guard lock(mutex);
+            closed = true;
+        }
+        ready.notify_all();
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<T> items;
+    bool closed = false;
+};
+
+struct Job {
+    std::uint64_t connection;
+    Request request;
+};
+
+struct Reply {
+    std::uint64_t connection;
+    std::string frame;
+};
+
+struct Connection {
+    int fd;
+    std::string in, out;
+    std::size_t pending  = 0;  // requests in the pool
+    std::uint32_t events = 0;
+    bool eof             = false;  // the peer sends nothing more but still reads
+};
+
+class Server {
+public:
+    Server(const Combinations &combinations, int listener, int signals, std::size_t workers)
+        : combinations(combinations), listener(listener) {
+        epoll  = epoll_create1(EPOLL_CLOEXEC);
+        wakeup = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        watch(listener, Listener, EPOLLIN);
+        watch(wakeup, Wakeup, EPOLLIN);
+        watch(signals, Signals, EPOLLIN);
+        for (std::size_t i = 0; i < workers; ++i) {
+            pool.emplace_back([this] { work(); });
+        }
+    }
+
+    ~Server() {
+        jobs.close();
+        for (auto &worker : pool) {
+            worker.join();
+        }
+        for (const auto &[id, connection] : connections) {
+            ::close(connection.fd);
+        }
+        ::close(wakeup);
+        ::close(epoll);
+    }
+
+    // Serves until a termination signal arrives
+    void run() {
+        epoll_event events[64];
+        for (bool running = true; running;) {
+            const auto count = epoll_wait(epoll, events, 64, -1);
+            for (int i = 0; i < count; ++i) {
+                switch (const auto source = events[i].data.u64) {
+                case Listener:
+                    accept_all();
+                    break;
+                case Wakeup:
+                    deliver();
+                    break;
+                case Signals:
+                    running = false;
+                    break;
+                default:
+                    serve(source, events[i].events);
+                }
+            }
+        }
+    }
+
+private:
+    void watch(int fd, std::uint64_t source, std::uint32_t events) {
+        epoll_event event{};
+        event.events   = events;
+        event.data.u64 = source;
+        epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &event);
+    }
+
+    void accept_all() {
+        for (int fd; (fd = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0;) {
+            const auto id = next_id++;
+            connections.emplace(id, Connection{fd, {}, {}, 0, EPOLLIN, false});
+            watch(fd, id, EPOLLIN);
+        }
+    }
+
+    void serve(std::uint64_t id, std::uint32_t events) {
+        const auto found = connections.find(id);
+        if (found == connections.end()) {
+            return;
+        }
+        auto &connection = found->second;
+        if ((events & (EPOLLERR | EPOLLHUP)) || ((events & EPOLLIN) && !receive(connection)) ||
+            ((events & EPOLLOUT) && !send(connection)) || !parse(id, connection)) {
+            return drop(id);
+        }
+        update(id, connection);
+    }
+
+    bool receive(Connection &connection) {
+        char buffer[1 << 16];
+        for (;;) {
+            const auto read = ::recv(connection.fd, buffer, sizeof(buffer), 0);
+            if (read > 0) {
+                connection.in.append(buffer, static_cast<std::size_t>(read));
+                continue;
+            }
+            connection.eof |= read == 0;
+            return read == 0 || errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+    }
+
+    bool send(Connection &connection) {
+        std::size_t sent = 0;
+        while (sent < connection.out.size()) {
+            const auto written =
+                ::send(connection.fd, connection.out.data() + sent, connection.out.size() - sent, MSG_NOSIGNAL);
+            if (written < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    break;
+                }
+                return false;
+            }
+            sent += static_cast<std::size_t>(written);
+        }
+        connection.out.erase(0, sent);
+        return true;
+    }
+
+    // Hands the complete frames read so far to the pool, false on a malformed frame
+    bool parse(std::uint64_t id, Connection &connection) {
+        std::size_t offset = 0;
+        while (connection.pending < max_pending) {
+            const std::string_view data = std::string_view(connection.in).substr(offset);
+            const auto length           = Frame::length(data);
+            if (length && *length > Frame::max_size) {
+                return false;
+            }
+            if (!length || data.size() < *length) {
+                break;
+            }
+            auto request = Request::decode(data.substr(Frame::header, *length - Frame::header));
+            if (!request) {
+                return false;
+            }
+            jobs.push({id, std::move(*request)});
+            ++connection.pending;
+            offset += *length;
+        }
+        connection.in.erase(0, offset);
+        return true;
+    }
+
+    // Reads while the connection may have more requests in the pool, writes while there is something to write, drops
+    // the connection once it is done
+    void update(std::uint64_t id, Connection &connection) {
+        if (connection.eof && connection.pending == 0 && connection.out.empty()) {
+            return drop(id);
+        }
+        std::uint32_t events = 0;
+        if (!connection.eof && connection.pending < max_pending) {
+            events |= EPOLLIN;
+        }
+        if (!connection.out.empty()) {
+            events |= EPOLLOUT;
+        }
+        if (events != connection.events) {
+            epoll_event event{};
+            event.events      = events;
+            event.data.u64    = id;
+            connection.events = events;
+            epoll_ctl(epoll, EPOLL_CTL_MOD, connection.fd, &event);
+        }
+    }
+
+    void drop(std::uint64_t id) {
+        const auto found = connections.find(id);
+        epoll_ctl(epoll, EPOLL_CTL_DEL, found->second.fd, nullptr);
+        ::close(found->second.fd);
+        connections.erase(found);
+    }
+
+    // Moves the replies of the workers to their connections
+    void deliver() {
+        std::uint64_t count;
+        if (::read(wakeup, &count, sizeof(count)) < 0) {
+            return;
+        }
+        for (auto &reply : replies.take()) {
+            const auto found = connections.find(reply.connection);
+            if (found == connections.end()) {
+                continue;
+            }
+            // A response that does not fit a frame closes its connection, the client would wait for it forever
+            if (reply.frame.empty()) {
+                drop(reply.connection);
+                continue;
+            }
+            auto &connection = found->second;
+            connection.out += reply.frame;
+            --connection.pending;
+            if (!send(connection) || !parse(reply.connection, connection)) {
+                drop(reply.connection);
+                continue;
+            }
+            update(reply.connection, connection);
+        }
+    }
+
+    void work() {
+        std::vector<int> order;
+        while (auto job = jobs.pop()) {
+            Budget budget(request_budget);
+            const auto result = combinations.classify(job->request.components, order, budget);
+            Response response{job->request.id, result.name, {}, result.status};
+            if (result.status == Classification::Status::Classified) {
+                response.order = order;
+            }
+            Reply reply{job->connection, {}};
+            response.encode(reply.frame);  // left empty if it does not fit
+            replies.push(std::move(reply));
+            const std::uint64_t one = 1;
+            if (::write(wakeup, &one, sizeof(one)) < 0) {
+                continue;
+            }
+        }
+    }
+
+    const Combinations &combinations;
+    const int listener;
+    int epoll, wakeup;
+    std::unordered_map<std::uint64_t, Connection> connections;
+    std::uint64_t next_id = Connections;
+    Queue<Job> jobs;
+    Queue<Reply> replies;
+    std::vector<std::thread> pool;
+};
+
+}  // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    constexpr std::string_view usage =
+        "Usage: combinations-server <combinations XML resource> <socket path> [number of workers, at least 1]";
+    if (argc != 3 && argc != 4) {
+        return fail(usage);
+    }
+
+    Combinations combinations;
+    const std::filesystem::path path{argv[1]};
+    if (!combinations.load(path)) {
+        return fail("Failed to load combinations XML resource from ", path);
+    }
+    const std::size_t workers = argc == 4 ? std::stoul(argv[3]) : std::max(1u, std::thread::hardware_concurrency());
+    if (workers == 0) {
+        return fail(usage);  // no worker would answer
+    }
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (std::strlen(argv[2]) >= sizeof(address.sun_path)) {
+        return fail("Socket path is too long: ", argv[2]);
+    }
+    std::strcpy(address.sun_path, argv[2]);
+    ::unlink(argv[2]);
+
+    const int listener = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listener < 0 || bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 ||
+        listen(listener, SOMAXCONN) < 0) {
+        return fail("Failed to listen on ", argv[2], ": ", std::strerror(errno));
+    }
+
+    // Termination signals are read from the loop, the workers inherit the mask
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &mask, nullptr);
+    const int signals = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+
+    {
+        Server server(combinations, listener, signals, workers);
+        server.run();
+    }
+    ::close(signals);
+    ::close(listener);
+    ::unlink(argv[2]);
+    return 0;
+}